@@ -1,50 +1,359 @@
 #include<bits/stdc++.h>
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <nmmintrin.h> // SSE4.2 crc32 instruction
+#endif
 using namespace std;
 
 // --- DATA STRUCTURE DEFINITIONS ---
 
+/**
+ * Interns strings so each distinct value is stored once and referred to
+ * by a small integer ID. Used for student IDs, venues and, in the fast
+ * configuration, event fields. intern() and release() count references;
+ * a value with none left is freed and its ID reused.
+ */
+class StringInterner {
+private:
+    deque<string> values; // deque keeps addresses stable for the keys below
+    vector<int> references;
+    vector<int> freeIDs;
+    unordered_map<string_view, int> ids;
+
+public:
+    /**
+     * Returns the ID of a value, or -1 if it is not interned.
+     */
+    int find(string_view text) const {
+        auto it = ids.find(text);
+        return it == ids.end() ? -1 : it->second;
+    }
+
+    /**
+     * Returns the ID of a value, adding it if needed, and takes a reference.
+     */
+    int intern(const string& text) {
+        int id = find(text);
+        if (id != -1) {
+            references[id]++;
+            return id;
+        }
+        if (!freeIDs.empty()) {
+            id = freeIDs.back();
+            freeIDs.pop_back();
+            values[id] = text;
+            references[id] = 1;
+        } else {
+            id = values.size();
+            values.push_back(text);
+            references.push_back(1);
+        }
+        ids[values[id]] = id;
+        return id;
+    }
+
+    void retain(int id) {
+        references[id]++;
+    }
+
+    /**
+     * Drops one reference. Returns true if that freed the value.
+     */
+    bool release(int id) {
+        if (--references[id] > 0) return false;
+        ids.erase(values[id]);
+        string().swap(values[id]);
+        freeIDs.push_back(id);
+        return true;
+    }
+
+    bool isLive(int id) const {
+        return references[id] > 0;
+    }
+
+    const string& get(int id) const {
+        return values[id];
+    }
+
+    /**
+     * Number of IDs handed out so far; every ID is below this.
+     */
+    size_t size() const {
+        return values.size();
+    }
+
+    /**
+     * Number of values currently interned.
+     */
+    size_t count() const {
+        return ids.size();
+    }
+
+    /**
+     * Approximate heap + inline bytes used by the interner.
+     */
+    size_t memoryUsage() const {
+        size_t bytes = 0;
+        for (const string& value : values) {
+            bytes += sizeof(string) + sizeof(int) + stringHeapBytes(value);
+        }
+        // One bucket pointer plus one node (key, value, next, hash) per entry
+        bytes += ids.bucket_count() * sizeof(void*);
+        bytes += ids.size() * (sizeof(string_view) + sizeof(int) + 2 * sizeof(void*));
+        return bytes;
+    }
+
+    /**
+     * Bytes a string keeps on the heap beyond its inline buffer.
+     */
+    static size_t stringHeapBytes(const string& text) {
+        return text.capacity() > 15 ? text.capacity() + 1 : 0;
+    }
+};
+
+/**
+ * A student known to the system, as seen through the StudentTable. The
+ * strings live in the table; a record is only a view of them.
+ */
+struct StudentRecord {
+    const string& studentID;
+    const string& studentName;
+};
+
+/**
+ * Interns students so each one is stored once and attendee lists can
+ * refer to them by a compact integer handle (the ID's interner ID).
+ * Every attendee holds a reference to its handle; a student nobody
+ * refers to is forgotten, so the ID can be registered under a new name.
+ */
+class StudentTable {
+private:
+    StringInterner studentIDs;
+    deque<string> names; // names[handle]
+
+public:
+    /**
+     * Returns the handle for a student ID, or -1 if it is unknown.
+     */
+    int find(const string& studentID) const {
+        return studentIDs.find(studentID);
+    }
+
+    /**
+     * Returns the existing handle for this student, or creates one, and
+     * takes a reference to it. Returns -1 if the ID is already known
+     * under a different name.
+     */
+    int intern(const string& studentID, const string& studentName) {
+        int handle = find(studentID);
+        if (handle != -1) {
+            if (names[handle] != studentName) return -1;
+            studentIDs.retain(handle);
+            return handle;
+        }
+        handle = studentIDs.intern(studentID);
+        if ((size_t)handle == names.size()) names.push_back(studentName);
+        else names[handle] = studentName; // A freed handle being reused
+        return handle;
+    }
+
+    void retain(int handle) {
+        studentIDs.retain(handle);
+    }
+
+    void release(int handle) {
+        if (studentIDs.release(handle)) string().swap(names[handle]);
+    }
+
+    StudentRecord get(int handle) const {
+        return {studentIDs.get(handle), names[handle]};
+    }
+
+    bool isLive(int handle) const {
+        return studentIDs.isLive(handle);
+    }
+
+    /**
+     * Number of students currently known.
+     */
+    size_t size() const {
+        return studentIDs.count();
+    }
+
+    /**
+     * Every handle ever handed out is below this.
+     */
+    size_t handleLimit() const {
+        return studentIDs.size();
+    }
+
+    size_t memoryUsage() const {
+        size_t bytes = studentIDs.memoryUsage();
+        for (const string& name : names) {
+            bytes += sizeof(string) + StringInterner::stringHeapBytes(name);
+        }
+        return bytes;
+    }
+};
+
 /*
     Node for a Singly Linked List to store attendees.
  */
 struct AttendeeNode {
-    string studentID;
-    string studentName;
+    int studentHandle; // Index into the StudentTable
     AttendeeNode* next;
 
-    AttendeeNode(string id, string name)
-        : studentID(id), studentName(name), next(nullptr) {}
+    AttendeeNode(int handle)
+        : studentHandle(handle), next(nullptr) {}
+};
+
+// --- STORAGE POLICIES ---
+//
+// EventTracker<IndexPolicy, AttendeePolicy, StringPolicy> is assembled
+// from three policies so that storage layouts can be benchmarked side by
+// side. ClassicTracker is the original design; FastTracker swaps in open
+// addressing, contiguous attendee arrays and interned strings.
+
+/**
+ * [STRING POLICY] Fields are ordinary std::string values. The pool is
+ * empty and only there to match InternedStrings.
+ */
+struct PlainStrings {
+    struct Pool {};
+    typedef string type;
+
+    static type make(Pool&, const string& text) { return text; }
+    static void release(Pool&, const type&) {}
+    static const string& get(const type& value) { return value; }
+};
+
+/**
+ * [STRING POLICY] Fields point into the tracker's own StringInterner, so
+ * repeated values such as venues and dates are stored once. A value is
+ * freed when no event uses it any more.
+ */
+struct InternedStrings {
+    typedef StringInterner Pool;
+    typedef const string* type;
+
+    static type make(Pool& pool, const string& text) { return &pool.get(pool.intern(text)); }
+    static void release(Pool& pool, type value) { pool.release(pool.find(*value)); }
+    static const string& get(type value) { return *value; }
+};
+
+/**
+ * [ATTENDEE POLICY] The original singly linked list, newest first.
+ */
+struct LinkedAttendees {
+    struct List {
+        AttendeeNode* head = nullptr;
+    };
+    typedef AttendeeNode* Cursor;
+
+    static const size_t BYTES_PER_ATTENDEE = sizeof(AttendeeNode);
+
+    static Cursor first(const List& list) { return list.head; }
+    static bool atEnd(const List&, Cursor cursor) { return cursor == nullptr; }
+    static Cursor next(const List&, Cursor cursor) { return cursor->next; }
+    static int handle(const List&, Cursor cursor) { return cursor->studentHandle; }
+
+    static void pushFront(List& list, int handle) {
+        AttendeeNode* newAttendee = new AttendeeNode(handle);
+        newAttendee->next = list.head;
+        list.head = newAttendee;
+    }
+
+    static void popFront(List& list) {
+        AttendeeNode* removed = list.head;
+        list.head = removed->next;
+        delete removed;
+    }
+
+    /**
+     * Replaces the list with handles given newest first, as in the file.
+     */
+    static void assign(List& list, const vector<int>& newestFirst) {
+        clear(list);
+        for (auto it = newestFirst.rbegin(); it != newestFirst.rend(); ++it) {
+            pushFront(list, *it);
+        }
+    }
+
+    static void clear(List& list) {
+        while (list.head != nullptr) popFront(list);
+    }
+};
+
+/**
+ * [ATTENDEE POLICY] One contiguous array of handles per event, stored
+ * oldest first so a new registration is a push_back.
+ */
+struct ContiguousAttendees {
+    struct List {
+        vector<int> handles;
+    };
+    typedef size_t Cursor; // Number of attendees already visited, newest first
+
+    static const size_t BYTES_PER_ATTENDEE = sizeof(int);
+
+    static Cursor first(const List&) { return 0; }
+    static bool atEnd(const List& list, Cursor cursor) { return cursor == list.handles.size(); }
+    static Cursor next(const List&, Cursor cursor) { return cursor + 1; }
+    static int handle(const List& list, Cursor cursor) { return list.handles[list.handles.size() - 1 - cursor]; }
+
+    static void pushFront(List& list, int handle) { list.handles.push_back(handle); }
+    static void popFront(List& list) { list.handles.pop_back(); }
+
+    static void assign(List& list, const vector<int>& newestFirst) {
+        list.handles.assign(newestFirst.rbegin(), newestFirst.rend());
+    }
+
+    static void clear(List& list) {
+        vector<int>().swap(list.handles);
+    }
 };
 
 /**
  * Node to store Event details.
  */
-struct EventNode {
+template <class AttendeePolicy, class StringPolicy>
+struct BasicEventNode {
+    typedef typename StringPolicy::type Str;
+
     string eventID;
-    string eventName;
-    string date; 
-    string venue;
-    string sortableDate; 
-    AttendeeNode* attendeeHead;
-    EventNode* next; 
-
-    EventNode(string id, string name, string dt, string v, string sort_dt)
-        : eventID(id), eventName(name), date(dt), venue(v), sortableDate(sort_dt), attendeeHead(nullptr), next(nullptr) {}
+    Str eventName;
+    Str date; 
+    Str venue;
+    Str sortableDate; 
+    typename AttendeePolicy::List attendees;
+    int attendeeCount; // Kept in step with the attendee list
+    BasicEventNode* next; 
+
+    BasicEventNode(typename StringPolicy::Pool& pool, const string& id, const string& name, const string& dt,
+                   const string& v, const string& sort_dt)
+        : eventID(id), eventName(StringPolicy::make(pool, name)), date(StringPolicy::make(pool, dt)),
+          venue(StringPolicy::make(pool, v)), sortableDate(StringPolicy::make(pool, sort_dt)),
+          attendeeCount(0), next(nullptr) {}
+
+    const string& getName() const { return StringPolicy::get(eventName); }
+    const string& getDate() const { return StringPolicy::get(date); }
+    const string& getVenue() const { return StringPolicy::get(venue); }
+    const string& getSortableDate() const { return StringPolicy::get(sortableDate); }
 };
 
 /**
- * The main EventTracker class.
+ * [INDEX POLICY] The original hash table of chained buckets.
  */
-class EventTracker {
+template <class Node>
+class ChainedIndex {
 private:
-    EventNode** hashTable;
+    Node** hashTable;
     int TABLE_SIZE;
-    string FILENAME = "events.txt";
 
     /**
      *
      * A simple hash function to map an Event ID string to an index.
      */
-    int hashFunction(const string& eventID) {
+    int hashFunction(const string& eventID) const {
         unsigned int hash = 0;
         for (char c : eventID) {
             hash = (hash * 31 + c) % TABLE_SIZE;
@@ -52,13 +361,20 @@ private:
         return hash;
     }
 
-    /**
-     * SEARCHING - Hash-Based
-     */
-    EventNode* findEvent(const string& eventID) {
-        int index = hashFunction(eventID);
-        EventNode* current = hashTable[index];
+public:
+    ChainedIndex(int size) : TABLE_SIZE(size) {
+        hashTable = new Node*[TABLE_SIZE];
+        for (int i = 0; i < TABLE_SIZE; ++i) {
+            hashTable[i] = nullptr;
+        }
+    }
+
+    ~ChainedIndex() {
+        delete[] hashTable;
+    }
 
+    Node* find(const string& eventID) const {
+        Node* current = hashTable[hashFunction(eventID)];
         while (current != nullptr) {
             if (current->eventID == eventID) {
                 return current;
@@ -68,495 +384,2986 @@ private:
         return nullptr; // Not found
     }
 
-    /**
-     * [SORTING - Insertion Sort by Name]
-     */
-    void insertionSort(vector<EventNode*>& events) {
-        for (int i = 1; i < events.size(); ++i) {
-            EventNode* key = events[i];
-            int j = i - 1;
+    void insert(Node* event) {
+        int index = hashFunction(event->eventID);
+        event->next = hashTable[index];
+        hashTable[index] = event;
+    }
 
-            // Compare event names for sorting
-            while (j >= 0 && events[j]->eventName > key->eventName) {
-                events[j + 1] = events[j];
-                j = j - 1;
-            }
-            events[j + 1] = key;
+    Node* erase(const string& eventID) {
+        int index = hashFunction(eventID);
+        Node* event = hashTable[index];
+        Node* prev = nullptr;
+
+        // Traverse the linked list (chain) to find the event
+        while (event != nullptr && event->eventID != eventID) {
+            prev = event;
+            event = event->next;
+        }
+        if (event == nullptr) return nullptr;
+
+        // Unlink it from the list.
+        if (prev == nullptr) {
+            hashTable[index] = event->next;
+        } else {
+            prev->next = event->next;
         }
+        event->next = nullptr;
+        return event;
     }
 
     /**
-     * [SORTING - Insertion Sort by Date]
+     * Visits every event. visit() may free the node it is given.
      */
-    void insertionSortByDate(vector<EventNode*>& events) {
-        for (int i = 1; i < events.size(); ++i) {
-            EventNode* key = events[i];
-            int j = i - 1;
-
-            // Compare sortableDate string (YYYYMMDD)
-            while (j >= 0 && events[j]->sortableDate > key->sortableDate) {
-                events[j + 1] = events[j];
-                j = j - 1;
+    template <typename Visitor>
+    void forEach(Visitor visit) const {
+        for (int i = 0; i < TABLE_SIZE; ++i) {
+            Node* current = hashTable[i];
+            while (current != nullptr) {
+                Node* following = current->next;
+                visit(current);
+                current = following;
             }
-            events[j + 1] = key;
         }
     }
+};
 
+/**
+ * [INDEX POLICY] Open addressing with linear probing over one flat
+ * array of pointers. Deleted slots become tombstones, and the table
+ * doubles once live + dead slots pass 70%.
+ */
+template <class Node>
+class OpenAddressingIndex {
+private:
+    vector<Node*> slots;
+    size_t live = 0;
+    size_t used = 0; // Live entries plus tombstones
 
-    /**
-     * Utility function to clear the input buffer safely.
-     */
-    void clearInputBuffer() {
-        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+    static Node* tombstone() {
+        return reinterpret_cast<Node*>(alignof(Node));
     }
 
-    /**
-     * Converts "DD/MM/YYYY" to "YYYYMMDD" for sorting.
-     */
-    string toSortableDate(const string& dd_mm_yyyy) {
-        // DD/MM/YYYY
-        // 0123456789
-        return dd_mm_yyyy.substr(6, 4) + dd_mm_yyyy.substr(3, 2) + dd_mm_yyyy.substr(0, 2);
+    size_t slotFor(const string& eventID) const {
+        return hash<string>()(eventID) & (slots.size() - 1);
     }
 
-    bool isLeap(int year) {
-        return (((year % 4 == 0) && (year % 100 != 0)) || (year % 400 == 0));
+    void rehash(size_t capacity) {
+        vector<Node*> old;
+        old.swap(slots);
+        slots.assign(capacity, nullptr);
+        live = used = 0;
+        for (Node* event : old) {
+            if (event != nullptr && event != tombstone()) insert(event);
+        }
     }
 
-    bool isValidDate(const string& date) {
-        if (date.length() != 10) return false;
-        if (date[2] != '/' || date[5] != '/') return false;
+public:
+    OpenAddressingIndex(int size) {
+        size_t capacity = 16;
+        while (capacity < (size_t)size * 2) capacity *= 2;
+        slots.assign(capacity, nullptr);
+    }
 
-        for (int i = 0; i < 10; ++i) {
-            if (i == 2 || i == 5) continue;
-            if (!isdigit(date[i])) return false;
+    Node* find(const string& eventID) const {
+        for (size_t i = slotFor(eventID);; i = (i + 1) & (slots.size() - 1)) {
+            Node* event = slots[i];
+            if (event == nullptr) return nullptr;
+            if (event != tombstone() && event->eventID == eventID) return event;
         }
+    }
 
-        int dd, mm, yyyy;
-        try {
-            dd = stoi(date.substr(0, 2));
-            mm = stoi(date.substr(3, 2));
-            yyyy = stoi(date.substr(6, 4));
-        } catch (...) {
-            return false;
+    void insert(Node* event) {
+        if ((used + 1) * 10 > slots.size() * 7) {
+            // Grow if most slots are live, otherwise just sweep the tombstones
+            rehash(live * 4 > slots.size() ? slots.size() * 2 : slots.size());
         }
+        for (size_t i = slotFor(event->eventID);; i = (i + 1) & (slots.size() - 1)) {
+            if (slots[i] == nullptr) {
+                used++;
+                live++;
+                slots[i] = event;
+                return;
+            }
+        }
+    }
 
-        if (yyyy < 1900 || yyyy > 2100) return false;
-        if (mm < 1 || mm > 12) return false;
-        if (dd < 1 || dd > 31) return false;
+    Node* erase(const string& eventID) {
+        for (size_t i = slotFor(eventID);; i = (i + 1) & (slots.size() - 1)) {
+            Node* event = slots[i];
+            if (event == nullptr) return nullptr;
+            if (event != tombstone() && event->eventID == eventID) {
+                slots[i] = tombstone();
+                live--;
+                return event;
+            }
+        }
+    }
 
-        if (mm == 2) {
-            if (isLeap(yyyy)) return (dd <= 29);
-            else return (dd <= 28);
+    template <typename Visitor>
+    void forEach(Visitor visit) const {
+        for (Node* event : slots) {
+            if (event != nullptr && event != tombstone()) visit(event);
         }
+    }
+};
 
-        if (mm == 4 || mm == 6 || mm == 9 || mm == 11)
-            return (dd <= 30);
+/**
+ * One reversible change in the undo history. It stores only the inverse
+ * delta: the old and new value of an updated field, the students added by
+ * a registration, or the node of an added/deleted event while that node
+ * is out of the hash table.
+ */
+struct OperationKind {
+    enum Kind { ADD_EVENT, DELETE_EVENT, UPDATE_NAME, UPDATE_DATE, UPDATE_VENUE, REGISTER };
 
-        return true;
+    static const char* name(Kind kind) {
+        static const char* const names[] = {"ADD", "DELETE", "NAME", "DATE", "VENUE", "REGISTER"};
+        return names[kind];
     }
+};
 
-    bool isValidName(const string& name) {
-        if (name.empty()) return false;
-        for (char c : name) {
-            if (!isalpha(c) && !isspace(c)) {
-                return false;
+template <class Node>
+struct BasicOperation : OperationKind {
+    Kind kind;
+    string eventID;
+    string before, after;       // UPDATE_*: old and new field values
+    int registered;             // REGISTER while applied: students it linked at the head
+    vector<pair<string, string>> undoneStudents; // REGISTER while undone: (studentID, name), in link order
+    Node* detached;             // ADD/DELETE: owned here while unlinked
+    bool continuesPrevious;     // Undone/redone together with the operation below it
+
+    BasicOperation(Kind k, const string& id)
+        : kind(k), eventID(id), registered(0), detached(nullptr), continuesPrevious(false) {}
+};
+
+// --- SEARCH INDEXES ---
+
+/**
+ * [BK-TREE]
+ * Indexes words by Levenshtein distance. Every child edge is labelled
+ * with its distance to the parent, so by the triangle inequality a query
+ * within distance k of the target only needs to follow edges labelled
+ * d-k .. d+k. Each word carries the items (events) it came from, ordered
+ * by a caller-supplied rank so they can be read nearest-rank first.
+ */
+template <typename Item>
+class BKTree {
+public:
+    typedef set<pair<int, Item>> Items; // (rank, item)
+
+private:
+    struct Node {
+        string word;
+        Items items;
+        vector<pair<int, int>> children; // (distance, node index)
+    };
+
+    vector<Node> nodes;
+    unordered_map<string, int> nodeByWord; // Exact lookups skip the tree walk
+    vector<int> prevRow, currRow; // Scratch rows for distance()
+
+public:
+    int distance(const string& a, const string& b) {
+        prevRow.resize(b.size() + 1);
+        currRow.resize(b.size() + 1);
+        for (size_t j = 0; j <= b.size(); ++j) prevRow[j] = j;
+
+        for (size_t i = 1; i <= a.size(); ++i) {
+            currRow[0] = i;
+            for (size_t j = 1; j <= b.size(); ++j) {
+                int cost = (a[i - 1] == b[j - 1]) ? 0 : 1;
+                currRow[j] = min({prevRow[j] + 1, currRow[j - 1] + 1, prevRow[j - 1] + cost});
             }
+            swap(prevRow, currRow);
         }
-        return true;
+        return prevRow[b.size()];
     }
-    
-    bool isValidID(const string& id) {
-        if (id.empty()) return false;
-        for (char c : id) {
-            if (!isalnum(c)) {
-                return false;
-            }
+
+    void insert(const string& word, int rank, Item item) {
+        auto known = nodeByWord.find(word);
+        if (known != nodeByWord.end()) {
+            nodes[known->second].items.insert({rank, item});
+            return;
         }
-        return true;
-    }
-    
-    bool isValidVenue(const string& venue) {
-        if (venue.empty()) return false;
-        for (char c : venue) {
-            if (!isalpha(c) && !isspace(c)) {
-                return false;
+        nodeByWord[word] = nodes.size();
+        if (nodes.empty()) {
+            nodes.push_back({word, {{rank, item}}, {}});
+            return;
+        }
+
+        int current = 0;
+        while (true) {
+            int d = distance(word, nodes[current].word);
+
+            int next = -1;
+            for (auto& child : nodes[current].children) {
+                if (child.first == d) {
+                    next = child.second;
+                    break;
+                }
+            }
+            if (next == -1) {
+                nodes[current].children.push_back({d, (int)nodes.size()});
+                nodes.push_back({word, {{rank, item}}, {}});
+                return;
             }
+            current = next;
         }
-        return true;
     }
 
-
     /**
-     * [FILE HANDLING]
-     * Loads all event and attendee data from the sequential file
+     * Detaches an item from a word in O(log n). The node itself stays in
+     * the tree as a routing point.
      */
-    void loadEventsFromFile() {
+    void remove(const string& word, int rank, Item item) {
+        auto known = nodeByWord.find(word);
+        if (known != nodeByWord.end()) nodes[known->second].items.erase({rank, item});
+    }
+
+    /**
+     * Returns (distance, word) for every word within maxDistance of the
+     * query, nearest first. Items are not touched, so this costs the same
+     * however many events share a word.
+     */
+    vector<pair<int, int>> matches(const string& query, int maxDistance) {
+        vector<pair<int, int>> found;
+        if (nodes.empty()) return found;
+
+        vector<int> stack = {0};
+        while (!stack.empty()) {
+            int current = stack.back();
+            stack.pop_back();
+
+            int d = distance(query, nodes[current].word);
+            if (d <= maxDistance && !nodes[current].items.empty()) {
+                found.push_back({d, current});
+            }
+            for (auto& child : nodes[current].children) {
+                if (child.first >= d - maxDistance && child.first <= d + maxDistance) {
+                    stack.push_back(child.second);
+                }
+            }
+        }
+        sort(found.begin(), found.end());
+        return found;
+    }
+
+    const Items& itemsOf(int word) const {
+        return nodes[word].items;
+    }
+
+    const string& wordOf(int word) const {
+        return nodes[word].word;
+    }
+};
+
+// --- OUTPUT HELPERS ---
+
+/**
+ * A large write buffer in front of a C FILE*, so exporters issue one
+ * fwrite per megabyte instead of one per field. The first failed write
+ * or close is remembered in error (an errno value) and later writes are
+ * dropped.
+ */
+class BufferedWriter {
+private:
+    FILE* file;
+    vector<char> buffer;
+    size_t used;
+    int error;
+
+    void writeToFile(const char* data, size_t length) {
+        if (file == nullptr || error != 0) return;
+        if (fwrite(data, 1, length, file) != length) {
+            error = errno != 0 ? errno : EIO;
+        }
+    }
+
+public:
+    BufferedWriter(const string& path, size_t capacity = 1 << 20)
+        : file(fopen(path.c_str(), "wb")), buffer(capacity), used(0), error(0) {}
+
+    ~BufferedWriter() {
+        close();
+    }
+
+    bool isOpen() const {
+        return file != nullptr;
+    }
+
+    /**
+     * Returns 0 if everything so far reached the file, else an errno value.
+     */
+    int lastError() const {
+        return error;
+    }
+
+    void flush() {
+        if (used > 0) {
+            writeToFile(buffer.data(), used);
+        }
+        used = 0;
+    }
+
+    /**
+     * Flushes and closes the file. Returns false if any write failed.
+     */
+    bool close() {
+        flush();
+        if (file != nullptr) {
+            if (fclose(file) != 0 && error == 0) {
+                error = errno != 0 ? errno : EIO;
+            }
+            file = nullptr;
+        }
+        return error == 0;
+    }
+
+    void write(const char* data, size_t length) {
+        if (length > buffer.size() - used) {
+            flush();
+            if (length > buffer.size()) {
+                writeToFile(data, length);
+                return;
+            }
+        }
+        memcpy(buffer.data() + used, data, length);
+        used += length;
+    }
+
+    void write(const string& text) {
+        write(text.data(), text.size());
+    }
+
+    void put(char c) {
+        if (used == buffer.size()) flush();
+        buffer[used++] = c;
+    }
+
+    void writeNumber(long long value) {
+        char digits[24];
+        auto result = to_chars(digits, digits + sizeof(digits), value);
+        write(digits, result.ptr - digits);
+    }
+
+    /**
+     * Writes a CSV field, quoting it only when it contains a delimiter,
+     * quote or line break.
+     */
+    void writeCsvField(const string& text) {
+        if (text.find_first_of(",\"\r\n") == string::npos) {
+            write(text);
+            return;
+        }
+        put('"');
+        for (char c : text) {
+            if (c == '"') put('"');
+            put(c);
+        }
+        put('"');
+    }
+
+    /**
+     * Writes a JSON string literal with the required escapes.
+     */
+    void writeJsonString(const string& text) {
+        put('"');
+        for (char c : text) {
+            switch (c) {
+                case '"':  write("\\\"", 2); break;
+                case '\\': write("\\\\", 2); break;
+                case '\n': write("\\n", 2); break;
+                case '\r': write("\\r", 2); break;
+                case '\t': write("\\t", 2); break;
+                default:
+                    if ((unsigned char)c < 0x20) {
+                        char escaped[7];
+                        snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned char)c);
+                        write(escaped, 6);
+                    } else {
+                        put(c);
+                    }
+            }
+        }
+        put('"');
+    }
+};
+
+// --- CHECKSUMS ---
+
+/**
+ * [CHECKSUM] CRC32C (Castagnoli), used to verify each saved event block.
+ * Runs on the SSE4.2 crc32 instruction when the CPU has it and falls
+ * back to a lookup table otherwise; both give the same result.
+ */
+class CRC32C {
+public:
+    static uint32_t extend(uint32_t crc, const char* data, size_t length) {
+        static const bool hardware = hasHardwareSupport();
+        crc = ~crc;
+        crc = hardware ? extendHardware(crc, data, length) : extendTable(crc, data, length);
+        return ~crc;
+    }
+
+    static uint32_t extend(uint32_t crc, const string& text) {
+        return extend(crc, text.data(), text.size());
+    }
+
+    static bool hasHardwareSupport() {
+#if defined(__x86_64__) && defined(__GNUC__)
+        return __builtin_cpu_supports("sse4.2");
+#else
+        return false;
+#endif
+    }
+
+    static string toHex(uint32_t crc) {
+        char hex[9];
+        snprintf(hex, sizeof(hex), "%08x", crc);
+        return hex;
+    }
+
+private:
+    static uint32_t extendTable(uint32_t crc, const char* data, size_t length) {
+        static const vector<uint32_t> table = [] {
+            vector<uint32_t> t(256);
+            for (uint32_t i = 0; i < 256; ++i) {
+                uint32_t c = i;
+                for (int bit = 0; bit < 8; ++bit) {
+                    c = (c & 1) ? (c >> 1) ^ 0x82F63B78u : c >> 1;
+                }
+                t[i] = c;
+            }
+            return t;
+        }();
+
+        for (size_t i = 0; i < length; ++i) {
+            crc = table[(crc ^ (unsigned char)data[i]) & 0xFF] ^ (crc >> 8);
+        }
+        return crc;
+    }
+
+#if defined(__x86_64__) && defined(__GNUC__)
+    __attribute__((target("sse4.2")))
+    static uint32_t extendHardware(uint32_t crc, const char* data, size_t length) {
+        uint64_t crc64 = crc;
+        for (; length >= 8; data += 8, length -= 8) {
+            uint64_t chunk;
+            memcpy(&chunk, data, 8);
+            crc64 = _mm_crc32_u64(crc64, chunk);
+        }
+        crc = (uint32_t)crc64;
+        for (; length > 0; ++data, --length) {
+            crc = _mm_crc32_u8(crc, (unsigned char)*data);
+        }
+        return crc;
+    }
+#else
+    static uint32_t extendHardware(uint32_t crc, const char* data, size_t length) {
+        return extendTable(crc, data, length);
+    }
+#endif
+};
+
+/**
+ * The main EventTracker class.
+ */
+template <template <class> class IndexPolicy, class AttendeePolicy, class StringPolicy>
+class EventTracker {
+public:
+    typedef BasicEventNode<AttendeePolicy, StringPolicy> EventNode;
+    typedef BasicOperation<EventNode> Operation;
+
+private:
+    // Declared first so it outlives every node that points into it
+    typename StringPolicy::Pool strings;
+    IndexPolicy<EventNode> hashTable;
+    string FILENAME = "events.txt";
+
+    // [SHARDED STORAGE] Events are split across SHARD_COUNT files by a hash
+    // of the Event ID. A shard is parsed the first time it is needed and is
+    // only written back on save if something in it changed.
+    int SHARD_COUNT = 16;
+    string SHARD_PREFIX = "events_shard_";
+    string MANIFEST_FILE = "events_shards.txt";
+    vector<bool> shardLoaded;
+    vector<bool> shardDirty;
+    vector<unordered_set<EventNode*>> shardEvents; // Loaded events of each shard
+
+    // Every student that appears in any attendee list. The table is
+    // persisted in STUDENTS_FILE so a student ID keeps one name across
+    // shards that have not been loaded yet. shardStudents[s] lists the
+    // students shard s held when the index was last read or written; a
+    // shard that is not loaded yet keeps a reference to each of them.
+    StudentTable students;
+    string STUDENTS_FILE = "events_students.txt";
+    bool studentsLoaded = false;
+    bool studentIndexStale = false; // No usable index: rebuild it on save
+    vector<vector<int>> shardStudents;
+
+    // [UNDO/REDO] Bounded stacks of inverse deltas, plus audit lines
+    // waiting to be appended to HISTORY_FILE on save. HISTORY_LIMIT counts
+    // steps: an entry plus the entries that continue it (e.g. one import).
+    // Both stacks are written to UNDO_FILE on save and read back at startup.
+    deque<Operation> undoStack;
+    deque<Operation> redoStack;
+    size_t HISTORY_LIMIT = 200;
+    size_t undoSteps = 0;
+    string HISTORY_FILE = "events_history.log";
+    string UNDO_FILE = "events_undo.txt";
+    vector<string> pendingAudit;
+
+    // [ORDERED INDEXES] (sort key, eventID) pairs kept sorted at all
+    // times, so listings never re-sort. A pair is also a page's resume
+    // token. Each pair maps straight to its node, so a page never goes back
+    // through the hash table.
+    typedef pair<string, string> IndexKey;
+    typedef map<IndexKey, EventNode*> OrderedIndex;
+    OrderedIndex nameOrder; // (eventName, eventID)
+    OrderedIndex dateOrder; // (sortableDate, eventID)
+    static const int PAGE_SIZE = 20;
+
+    // [VENUE INDEX] Each venue string is interned to a small ID, and each
+    // ID maps to the events held there as (sortableDate, eventID) pairs.
+    StringInterner venues;
+    vector<OrderedIndex> eventsByVenue;
+
+    // Lowercased event-name words for typo-tolerant search
+    BKTree<EventNode*> nameIndex;
+    static const int FUZZY_TOP_K = 10;
+
+    // An export may run on this thread while the menu stays usable. Every
+    // operation that changes the store joins it first. The thread never
+    // prints; it leaves its summary in exportMessage for the main thread.
+    thread exportThread;
+    atomic<bool> exportFinished{false};
+    string exportMessage;
+
+    /**
+     * Maps an Event ID to its shard. This does not depend on the index
+     * policy or table size, so the on-disk layout survives either changing.
+     */
+    int shardFunction(const string& eventID) {
+        unsigned int hash = 0;
+        for (char c : eventID) {
+            hash = hash * 131 + (unsigned char)c;
+        }
+        return hash % SHARD_COUNT;
+    }
+
+    string shardFileName(int shard) {
+        return SHARD_PREFIX + to_string(shard) + ".txt";
+    }
+
+    void markDirty(const string& eventID) {
+        shardDirty[shardFunction(eventID)] = true;
+    }
+
+    /**
+     * Links an event node into the hash index and every secondary index.
+     */
+    void insertEvent(EventNode* event) {
+        hashTable.insert(event);
+        shardEvents[shardFunction(event->eventID)].insert(event);
+        indexEventName(event);
+        nameOrder[{event->getName(), event->eventID}] = event;
+        dateOrder[{event->getSortableDate(), event->eventID}] = event;
+        eventsByVenue[venueID(event->getVenue())][{event->getSortableDate(), event->eventID}] = event;
+    }
+
+    /**
+     * Returns the ID of a venue, assigning the next free one if it has
+     * not been seen before.
+     */
+    int venueID(const string& venue) {
+        int id = venues.find(venue);
+        if (id != -1) return id;
+
+        id = venues.intern(venue);
+        eventsByVenue.emplace_back();
+        return id;
+    }
+
+    /**
+     * Returns the ID of a known venue, or -1.
+     */
+    int findVenue(const string& venue) {
+        return venues.find(venue);
+    }
+
+    /**
+     * Removes an event from the hash index and every secondary index
+     * without freeing it. Returns nullptr if the event does not exist.
+     */
+    EventNode* unlinkEvent(const string& eventID) {
+        ensureShardLoaded(shardFunction(eventID));
+        EventNode* event = hashTable.erase(eventID);
+        if (event == nullptr) return nullptr;
+
+        shardEvents[shardFunction(eventID)].erase(event);
+        unindexEventName(event);
+        nameOrder.erase({event->getName(), event->eventID});
+        dateOrder.erase({event->getSortableDate(), event->eventID});
+        eventsByVenue[venueID(event->getVenue())].erase({event->getSortableDate(), event->eventID});
+        markDirty(eventID);
+        return event;
+    }
+
+    void deleteEventNode(EventNode* event) {
+        forEachAttendee(event, [this](int handle) { students.release(handle); });
+        AttendeePolicy::clear(event->attendees);
+        StringPolicy::release(strings, event->eventName);
+        StringPolicy::release(strings, event->date);
+        StringPolicy::release(strings, event->venue);
+        StringPolicy::release(strings, event->sortableDate);
+        delete event;
+    }
+
+    /**
+     * Calls visit(studentHandle) for each attendee, newest first.
+     */
+    template <typename Visitor>
+    void forEachAttendee(const EventNode* event, Visitor visit) {
+        const typename AttendeePolicy::List& list = event->attendees;
+        for (auto cursor = AttendeePolicy::first(list); !AttendeePolicy::atEnd(list, cursor);
+             cursor = AttendeePolicy::next(list, cursor)) {
+            visit(AttendeePolicy::handle(list, cursor));
+        }
+    }
+
+    /**
+     * Splits a name into the lowercase words stored in the BK-tree. Event
+     * names share a small vocabulary, so the tree stays far smaller than
+     * the number of events.
+     */
+    vector<string> fuzzyKeys(const string& name) {
+        vector<string> keys;
+        string word;
+        for (char c : name) {
+            if (isspace((unsigned char)c)) {
+                if (!word.empty()) keys.push_back(word);
+                word.clear();
+            } else {
+                word += tolower((unsigned char)c);
+            }
+        }
+        if (!word.empty()) keys.push_back(word);
+        return keys;
+    }
+
+    // Items of a word are ranked by name length, so a search can read the
+    // names closest in length to the query first.
+    void indexEventName(EventNode* event) {
+        for (const string& key : fuzzyKeys(event->getName())) {
+            nameIndex.insert(key, event->getName().size(), event);
+        }
+    }
+
+    void unindexEventName(EventNode* event) {
+        for (const string& key : fuzzyKeys(event->getName())) {
+            nameIndex.remove(key, event->getName().size(), event);
+        }
+    }
+
+    /**
+     * Typos allowed in a query word, scaled to its length.
+     */
+    int fuzzyThreshold(const string& word) {
+        if (word.size() <= 2) return 0;
+        if (word.size() <= 5) return 1;
+        if (word.size() <= 9) return 2;
+        return 3;
+    }
+
+    /**
+     * SEARCHING - Hash-Based
+     */
+    EventNode* findEvent(const string& eventID) {
+        ensureShardLoaded(shardFunction(eventID));
+        return hashTable.find(eventID);
+    }
+
+    /**
+     * [PAGINATION]
+     * A resume token is the (key, eventID) pair of the last row shown,
+     * written as "key|eventID". Keys never contain '|', so the last one
+     * separates the two parts.
+     */
+    string makeToken(const IndexKey& key) {
+        return key.first + "|" + key.second;
+    }
+
+    bool parseToken(const string& token, IndexKey& key) {
+        size_t bar = token.rfind('|');
+        if (bar == string::npos) return false;
+        key = {token.substr(0, bar), token.substr(bar + 1)};
+        return true;
+    }
+
+    /**
+     * [PAGINATION]
+     * Pages through an ordered index, showing only events that pass
+     * keep(). Each page starts strictly after a cursor, so fetching page N
+     * costs O(log n + page size) instead of a full sort, and a token stays
+     * valid even if other events are added or removed. Each page is built
+     * in memory and written to the terminal in one go.
+     */
+    template <typename Keep, typename Row>
+    void browseIndex(const OrderedIndex& index, const string& header, Keep keep, Row writeRow) {
+        const string rule = "------------------------------------------------------------------\n";
+        optional<IndexKey> cursor;             // Empty = start of the index
+        vector<optional<IndexKey>> pageStarts; // Cursors of the earlier pages
+
+        while (true) {
+            auto it = cursor ? index.upper_bound(*cursor) : index.begin();
+            ostringstream page;
+            page << rule << header << rule;
+
+            int shown = 0;
+            IndexKey last;
+            for (; it != index.end() && shown < PAGE_SIZE; ++it) {
+                if (!keep(it->second)) continue;
+                writeRow(page, it->second);
+                last = it->first;
+                shown++;
+            }
+            // Look ahead for one more match so we know if "next" exists
+            while (it != index.end() && !keep(it->second)) {
+                ++it;
+            }
+            bool hasNext = (it != index.end());
+            bool hasPrev = !pageStarts.empty();
+
+            if (shown == 0) {
+                page << "No events found.\n";
+            }
+            page << rule;
+            if (hasNext || hasPrev) {
+                page << "Page " << pageStarts.size() + 1;
+                if (shown > 0) page << "  |  Resume token: " << makeToken(last);
+                page << "\n";
+            }
+
+            string text = page.str();
+            cout.write(text.data(), text.size());
+            cout.flush();
+
+            if (!hasNext && !hasPrev) return; // Everything fit on one page
+
+            string command;
+            cout << "[" << (hasNext ? "n = next, " : "") << (hasPrev ? "p = previous, " : "")
+                 << "t = resume from token, q = quit]: ";
+            if (!getline(cin, command) || command.empty()) return;
+
+            char c = tolower((unsigned char)command[0]);
+            if (c == 'n' && hasNext) {
+                pageStarts.push_back(cursor);
+                cursor = last;
+            } else if (c == 'p' && hasPrev) {
+                cursor = pageStarts.back();
+                pageStarts.pop_back();
+            } else if (c == 't') {
+                string token;
+                IndexKey key;
+                cout << "Enter resume token: ";
+                getline(cin, token);
+                if (!parseToken(token, key)) {
+                    cout << "Invalid token.\n";
+                    return;
+                }
+                cursor = key;
+                pageStarts.clear();
+            } else if (c == 'q') {
+                return;
+            }
+        }
+    }
+
+    /**
+     * Utility function to clear the input buffer safely.
+     */
+    void clearInputBuffer() {
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+    }
+
+    /**
+     * Converts "DD/MM/YYYY" to "YYYYMMDD" for sorting.
+     */
+    string toSortableDate(const string& dd_mm_yyyy) {
+        // DD/MM/YYYY
+        // 0123456789
+        return dd_mm_yyyy.substr(6, 4) + dd_mm_yyyy.substr(3, 2) + dd_mm_yyyy.substr(0, 2);
+    }
+
+    bool isLeap(int year) {
+        return (((year % 4 == 0) && (year % 100 != 0)) || (year % 400 == 0));
+    }
+
+    bool isValidDate(const string& date) {
+        if (date.length() != 10) return false;
+        if (date[2] != '/' || date[5] != '/') return false;
+
+        for (int i = 0; i < 10; ++i) {
+            if (i == 2 || i == 5) continue;
+            if (!isdigit(date[i])) return false;
+        }
+
+        int dd, mm, yyyy;
+        try {
+            dd = stoi(date.substr(0, 2));
+            mm = stoi(date.substr(3, 2));
+            yyyy = stoi(date.substr(6, 4));
+        } catch (...) {
+            return false;
+        }
+
+        if (yyyy < 1900 || yyyy > 2100) return false;
+        if (mm < 1 || mm > 12) return false;
+        if (dd < 1 || dd > 31) return false;
+
+        if (mm == 2) {
+            if (isLeap(yyyy)) return (dd <= 29);
+            else return (dd <= 28);
+        }
+
+        if (mm == 4 || mm == 6 || mm == 9 || mm == 11)
+            return (dd <= 30);
+
+        return true;
+    }
+
+    bool isValidName(const string& name) {
+        if (name.empty()) return false;
+        for (char c : name) {
+            if (!isalpha(c) && !isspace(c)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    bool isValidID(const string& id) {
+        if (id.empty()) return false;
+        for (char c : id) {
+            if (!isalnum(c)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    bool isValidVenue(const string& venue) {
+        if (venue.empty()) return false;
+        for (char c : venue) {
+            if (!isalpha(c) && !isspace(c)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Splits one CSV line into fields. Double-quoted fields may contain
+     * commas, and "" inside quotes is read as a single quote.
+     */
+    vector<string> parseCsvLine(const string& line) {
+        vector<string> fields;
+        string field;
+        bool inQuotes = false;
+
+        for (size_t i = 0; i < line.size(); ++i) {
+            char c = line[i];
+            if (inQuotes) {
+                if (c == '"' && i + 1 < line.size() && line[i + 1] == '"') {
+                    field += '"';
+                    ++i;
+                } else if (c == '"') {
+                    inQuotes = false;
+                } else {
+                    field += c;
+                }
+            } else if (c == '"') {
+                inQuotes = true;
+            } else if (c == ',') {
+                fields.push_back(field);
+                field.clear();
+            } else {
+                field += c;
+            }
+        }
+        fields.push_back(field);
+        return fields;
+    }
+
+    string trim(const string& text) {
+        size_t first = text.find_first_not_of(" \t\r");
+        if (first == string::npos) return "";
+        size_t last = text.find_last_not_of(" \t\r");
+        return text.substr(first, last - first + 1);
+    }
+
+    // --- Bulk import bookkeeping ---
+    struct ImportRow {
+        int lineNo;
+        string studentID;
+        string studentName;
+    };
+
+    struct ImportReport {
+        long long imported = 0;
+        long long duplicates = 0;
+        long long errors = 0;
+        int historyOps = 0;
+        // (line, message) for the lowest line numbers only. Event-level
+        // errors are found after the rows are grouped, so they arrive out
+        // of line order; the max-heap drops the highest line first.
+        priority_queue<pair<int, string>> errorMessages;
+    };
+
+    static const int MAX_REPORTED_ERRORS = 20;
+
+    void recordImportError(ImportReport& report, int lineNo, const string& reason) {
+        report.errors++;
+        if (report.errorMessages.size() < MAX_REPORTED_ERRORS || lineNo < report.errorMessages.top().first) {
+            report.errorMessages.push({lineNo, "Line " + to_string(lineNo) + ": " + reason});
+            if (report.errorMessages.size() > MAX_REPORTED_ERRORS) report.errorMessages.pop();
+        }
+    }
+
+    /**
+     * [HASHING + LINKED LIST]
+     * Applies one batch of rows that has been grouped by Event ID, so each
+     * event is looked up once and its attendee list is scanned once for
+     * duplicates. New attendees go in front of the existing ones, exactly
+     * as if they had registered one by one.
+     */
+    void applyImportBatch(unordered_map<string, vector<ImportRow>>& batch, ImportReport& report) {
+        ensureStudentsLoaded();
+        for (auto& group : batch) {
+            const string& eventID = group.first;
+            vector<ImportRow>& rows = group.second;
+
+            EventNode* event = findEvent(eventID);
+            if (event == nullptr) {
+                for (const ImportRow& row : rows) {
+                    recordImportError(report, row.lineNo, "Event '" + eventID + "' not found.");
+                }
+                continue;
+            }
+
+            unordered_set<int> registered;
+            forEachAttendee(event, [&](int handle) { registered.insert(handle); });
+
+            long long added = 0;
+            Operation op(Operation::REGISTER, eventID);
+            for (const ImportRow& row : rows) {
+                int handle = students.intern(row.studentID, row.studentName);
+                if (handle == -1) {
+                    recordImportError(report, row.lineNo, "Student ID '" + row.studentID + "' is already registered as '"
+                                      + students.get(students.find(row.studentID)).studentName + "'.");
+                    continue;
+                }
+                if (!registered.insert(handle).second) {
+                    students.release(handle);
+                    report.duplicates++;
+                    continue;
+                }
+                AttendeePolicy::pushFront(event->attendees, handle);
+                op.registered++;
+                added++;
+            }
+
+            if (added > 0) {
+                event->attendeeCount += added;
+                report.imported += added;
+                markDirty(eventID);
+
+                // The whole import is undone as one step
+                op.continuesPrevious = report.historyOps++ > 0;
+                recordOperation(move(op), event);
+            }
+        }
+        batch.clear();
+    }
+
+
+    /**
+     * Splits a '|' separated line into at most maxFields views. Returns
+     * the number of fields, or maxFields + 1 if there are more.
+     */
+    static int splitFields(const string& line, string_view* fields, int maxFields) {
+        string_view rest(line);
+        int count = 0;
+        while (true) {
+            if (count == maxFields) return maxFields + 1;
+            size_t bar = rest.find('|');
+            fields[count++] = rest.substr(0, bar);
+            if (bar == string_view::npos) return count;
+            rest.remove_prefix(bar + 1);
+        }
+    }
+
+    /**
+     * An event line has exactly five fields and a date that matches its
+     * sortable form.
+     */
+    bool isEventLine(const string& line, string_view* fields) {
+        if (splitFields(line, fields, 5) != 5) return false;
+        string date(fields[2]);
+        return isValidID(string(fields[0])) && isValidDate(date) && fields[4] == toSortableDate(date);
+    }
+
+    /**
+     * [FILE HANDLING]
+     * Parses events and their attendees from an open file and links
+     * them into the hash table. Returns the number of events read.
+     *
+     * Each block is an event line, its attendee lines, and an
+     * END_EVENT|<crc32c> line whose checksum covers the lines above it.
+     * A block that is truncated, malformed or fails its checksum is
+     * skipped, reported and counted in `rejected`; its raw lines are
+     * appended to <file>.rejected so nothing is lost when the shard is
+     * next saved.
+     * Blocks ending in a plain END_EVENT (older files) are accepted
+     * when their lines are well formed. An attendee whose student ID is
+     * already known under another name is loaded under the known name and
+     * reported; the block itself is kept.
+     *
+     * `shard` is the shard the file holds, or -1 for the unsharded file.
+     * None of its events are in memory before it is read, so duplicates
+     * are found in a set of the IDs seen in this file. An event whose ID
+     * belongs to another shard is held back until the file is read, then
+     * moved to its own shard, which is loaded first so a copy already
+     * there is caught.
+     */
+    int readEventsFrom(ifstream& inFile, const string& fileName, int shard, int& rejected) {
+        ensureStudentsLoaded();
+        string line;
+        string_view fields[6];
+        int eventsRead = 0;
+        int lineNo = 0;
+
+        // The block being read
+        bool inBlock = false;
+        string problem;                           // Empty while the block looks intact
+        int blockLine = 0;
+        string eventFields[5];
+        vector<pair<string, string>> blockAttendees; // Newest first
+        uint32_t crc = 0;
+        vector<string> rawLines;
+
+        rejected = 0;
+        vector<string> rejectedLines;
+        unordered_set<string> seenIDs;
+        int renamed = 0; // Attendees kept under a name seen earlier
+
+        struct MisplacedEvent {
+            EventNode* event;
+            int line;
+            vector<string> rawLines;
+        };
+        vector<MisplacedEvent> misplaced;
+
+        auto rejectBlock = [&](const string& reason) {
+            if (++rejected <= 5) {
+                cout << "[System] Warning: " << fileName << " line " << blockLine << ": skipped event block '"
+                     << (eventFields[0].empty() ? "?" : eventFields[0]) << "' (" << reason << ")." << endl;
+            }
+            rejectedLines.insert(rejectedLines.end(), rawLines.begin(), rawLines.end());
+        };
+
+        auto acceptBlock = [&]() {
+            const string& eventID = eventFields[0];
+            if (seenIDs.count(eventID) > 0) {
+                rejectBlock("duplicate event ID");
+                return;
+            }
+
+            // A student ID has one name. Older files never checked this, so
+            // a different name is a conflict to report, not damage: the
+            // attendee is kept under the name seen first.
+            vector<int> handles;
+            handles.reserve(blockAttendees.size());
+            for (const pair<string, string>& attendee : blockAttendees) {
+                int handle = students.find(attendee.first);
+                if (handle == -1) {
+                    handle = students.intern(attendee.first, attendee.second);
+                } else {
+                    students.retain(handle);
+                    if (students.get(handle).studentName != attendee.second && ++renamed <= 5) {
+                        cout << "[System] Warning: " << fileName << " line " << blockLine << ": student '"
+                             << attendee.first << "' in event '" << eventID << "' is listed as '" << attendee.second
+                             << "' but was first seen as '" << students.get(handle).studentName
+                             << "'. Keeping '" << students.get(handle).studentName << "'." << endl;
+                    }
+                }
+                handles.push_back(handle);
+            }
+            EventNode* event = new EventNode(strings, eventFields[0], eventFields[1], eventFields[2], eventFields[3], eventFields[4]);
+            AttendeePolicy::assign(event->attendees, handles);
+            event->attendeeCount = handles.size();
+            seenIDs.insert(eventID);
+            if (shard != -1 && shardFunction(eventID) != shard) {
+                misplaced.push_back({event, blockLine, rawLines});
+                return;
+            }
+            insertEvent(event);
+            eventsRead++;
+        };
+
+        auto startBlock = [&]() {
+            inBlock = true;
+            problem.clear();
+            blockLine = lineNo;
+            for (string& field : eventFields) field.clear();
+            blockAttendees.clear();
+            crc = 0;
+            rawLines.clear();
+        };
+
+        while (getline(inFile, line)) {
+            lineNo++;
+            bool isTerminator = line.compare(0, 9, "END_EVENT") == 0;
+
+            if (!inBlock) {
+                if (line.empty()) continue;
+                startBlock();
+                if (isTerminator) {
+                    rawLines.push_back(line);
+                    rejectBlock("END_EVENT without an event line");
+                    inBlock = false;
+                    continue;
+                }
+            } else if (!isTerminator && isEventLine(line, fields)) {
+                // A new event line before END_EVENT: the previous block lost its end
+                rejectBlock(problem.empty() ? "missing END_EVENT" : problem);
+                startBlock();
+            }
+            rawLines.push_back(line);
+
+            if (isTerminator) {
+                if (problem.empty()) {
+                    if (line.size() == 9) {
+                        // Older file without a checksum
+                    } else if (line.size() != 18 || line[9] != '|') {
+                        problem = "malformed END_EVENT line";
+                    } else if (line.compare(10, 8, CRC32C::toHex(crc)) != 0) {
+                        problem = "checksum mismatch";
+                    }
+                }
+                if (problem.empty()) acceptBlock();
+                else rejectBlock(problem);
+                inBlock = false;
+                continue;
+            }
+
+            crc = CRC32C::extend(crc, line);
+            crc = CRC32C::extend(crc, "\n", 1);
+            if (!problem.empty()) continue;
+
+            if (rawLines.size() == 1) {
+                if (!isEventLine(line, fields)) {
+                    problem = "malformed event line";
+                    continue;
+                }
+                for (int i = 0; i < 5; ++i) eventFields[i] = string(fields[i]);
+            } else if (splitFields(line, fields, 2) == 2 && !fields[0].empty() && !fields[1].empty()) {
+                blockAttendees.emplace_back(string(fields[0]), string(fields[1]));
+            } else {
+                problem = "malformed attendee line " + to_string(lineNo);
+            }
+        }
+        if (inBlock) {
+            rejectBlock(problem.empty() ? "file ends before END_EVENT" : problem);
+        }
+
+        int moved = 0;
+        for (MisplacedEvent& entry : misplaced) {
+            EventNode* event = entry.event;
+            int home = shardFunction(event->eventID);
+            ensureShardLoaded(home);
+            if (hashTable.find(event->eventID) != nullptr) {
+                blockLine = entry.line;
+                eventFields[0] = event->eventID;
+                rawLines = entry.rawLines;
+                rejectBlock("duplicate of an event in " + shardFileName(home));
+                deleteEventNode(event);
+                continue;
+            }
+            insertEvent(event);
+            shardDirty[home] = true;
+            shardDirty[shard] = true;
+            eventsRead++;
+            moved++;
+        }
+        if (moved > 0) {
+            cout << "[System] " << fileName << ": " << moved << " event(s) belong to other shards and will be"
+                 << " moved there on the next save." << endl;
+        }
+
+        if (renamed > 0) {
+            cout << "[System] " << fileName << ": " << renamed << " attendee(s) had a different name for a known"
+                 << " student ID and were kept under the first name seen." << endl;
+            // Write the kept names back on the next save
+            if (shard != -1) shardDirty[shard] = true;
+        }
+
+        if (rejected > 0) {
+            if (rejected > 5) {
+                cout << "[System] Warning: ... and " << rejected - 5 << " more skipped block(s)." << endl;
+            }
+            ofstream quarantine(fileName + ".rejected", ios::app);
+            for (const string& raw : rejectedLines) {
+                quarantine << raw << "\n";
+            }
+            cout << "[System] " << fileName << ": loaded " << eventsRead << " event(s), skipped " << rejected
+                 << " block(s). Their lines were saved to " << fileName << ".rejected" << endl;
+        }
+        return eventsRead;
+    }
+
+    /**
+     * [FILE HANDLING]
+     * Loads a single shard file the first time it is touched.
+     */
+    void ensureShardLoaded(int shard) {
+        if (shardLoaded[shard]) return;
+        ensureStudentsLoaded(); // Building a missing index loads every shard, this one included
+        if (shardLoaded[shard]) return;
+        shardLoaded[shard] = true;
+
+        ifstream inFile(shardFileName(shard));
+        if (inFile) {
+            int rejected;
+            readEventsFrom(inFile, shardFileName(shard), shard, rejected);
+            inFile.close();
+
+            // Rewrite the shard without the bad blocks on the next save
+            if (rejected > 0) shardDirty[shard] = true;
+        }
+
+        // Its attendees now hold its students
+        for (int handle : shardStudents[shard]) students.release(handle);
+    }
+
+    void ensureAllShardsLoaded() {
+        for (int s = 0; s < SHARD_COUNT; ++s) {
+            ensureShardLoaded(s);
+        }
+    }
+
+    /**
+     * [FILE HANDLING]
+     * Loads the student index the first time a student is interned, so
+     * names are checked against every saved student, not only those in
+     * shards loaded so far. Each line is "studentID|name|shards", where
+     * shards lists the shards the student appears in. Storage without an
+     * index, or with one that has no shard lists, is scanned once to
+     * build it.
+     */
+    void ensureStudentsLoaded() {
+        if (studentsLoaded) return;
+        studentsLoaded = true;
+
+        ifstream inFile(STUDENTS_FILE);
+        bool found = inFile.is_open();
+        vector<string> lines;
+        string line;
+        bool listsShards = true;
+        while (getline(inFile, line)) {
+            if (line.empty()) continue;
+            if (count(line.begin(), line.end(), '|') < 2) listsShards = false;
+            lines.push_back(line);
+        }
+        if (!found || !listsShards) {
+            studentIndexStale = true;
+            ensureAllShardsLoaded();
+            return;
+        }
+
+        string_view fields[4];
+        for (size_t i = 0; i < lines.size(); ++i) {
+            int handle = -1;
+            if (splitFields(lines[i], fields, 3) == 3 && !fields[0].empty() && !fields[1].empty()) {
+                handle = students.intern(string(fields[0]), string(fields[1]));
+            }
+            if (handle == -1) {
+                cout << "[System] Warning: " << STUDENTS_FILE << " line " << i + 1
+                     << ": ignored malformed or conflicting student entry." << endl;
+                continue;
+            }
+
+            // Each shard that is not loaded yet keeps the student known
+            stringstream shards{string(fields[2])};
+            int shard;
+            while (shards >> shard) {
+                if (shard < 0 || shard >= SHARD_COUNT) continue;
+                shardStudents[shard].push_back(handle);
+                if (!shardLoaded[shard]) students.retain(handle);
+            }
+            students.release(handle);
+        }
+    }
+
+    /**
+     * [FILE HANDLING]
+     * Rewrites the student index before shards are saved. The students of
+     * each dirty shard are collected again; other shards have not changed
+     * since their list was read. A student no shard lists is left out.
+     */
+    void saveStudentIndex() {
+        ensureStudentsLoaded();
+        bool changed = studentIndexStale;
+        for (int s = 0; s < SHARD_COUNT; ++s) {
+            if (shardDirty[s]) changed = true;
+        }
+        if (!changed) return;
+
+        vector<int> seenInShard(students.handleLimit(), -1);
+        vector<vector<int>> shardsOf(students.handleLimit());
+        for (int s = 0; s < SHARD_COUNT; ++s) {
+            if (shardLoaded[s] && (shardDirty[s] || studentIndexStale)) {
+                shardStudents[s].clear();
+                for (EventNode* event : shardEvents[s]) {
+                    forEachAttendee(event, [&](int handle) {
+                        if (seenInShard[handle] == s) return;
+                        seenInShard[handle] = s;
+                        shardStudents[s].push_back(handle);
+                    });
+                }
+            }
+            for (int handle : shardStudents[s]) {
+                shardsOf[handle].push_back(s);
+            }
+        }
+
+        ofstream outFile(STUDENTS_FILE);
+        if (!outFile) {
+            cerr << "Error: Could not open " << STUDENTS_FILE << " for writing." << endl;
+            return;
+        }
+        for (size_t handle = 0; handle < shardsOf.size(); ++handle) {
+            if (shardsOf[handle].empty() || !students.isLive(handle)) continue;
+            const StudentRecord& student = students.get(handle);
+            outFile << student.studentID << "|" << student.studentName << "|";
+            for (size_t i = 0; i < shardsOf[handle].size(); ++i) {
+                outFile << (i > 0 ? " " : "") << shardsOf[handle][i];
+            }
+            outFile << "\n";
+        }
+        studentIndexStale = false;
+    }
+
+    /**
+     * [FILE HANDLING]
+     * Reads only the shard manifest at startup; shard contents are loaded
+     * lazily. A pre-sharding events.txt is imported once and every shard
+     * is marked dirty so the next save migrates it.
+     */
+    void loadEventsFromFile() {
+        ifstream manifest(MANIFEST_FILE);
+        int count;
+        if (manifest && manifest >> count && count > 0) {
+            SHARD_COUNT = count;
+            shardLoaded.assign(SHARD_COUNT, false);
+            shardDirty.assign(SHARD_COUNT, false);
+            shardEvents.assign(SHARD_COUNT, {});
+            shardStudents.assign(SHARD_COUNT, {});
+            cout << "[System] Found " << SHARD_COUNT << " event shards. They will be loaded on demand." << endl;
+            return;
+        }
+
+        shardLoaded.assign(SHARD_COUNT, true);
+        shardDirty.assign(SHARD_COUNT, false);
+        shardEvents.assign(SHARD_COUNT, {});
+        shardStudents.assign(SHARD_COUNT, {});
+
         ifstream inFile(FILENAME);
         if (!inFile) {
             cout << "[System] No existing event file found. Starting fresh." << endl;
             return;
         }
 
-        string line;
-        EventNode* currentEvent = nullptr;
+        int rejected;
+        int eventsRead = readEventsFrom(inFile, FILENAME, -1, rejected);
+        inFile.close();
+        shardDirty.assign(SHARD_COUNT, true);
+        cout << "[System] Loaded " << eventsRead << " events from " << FILENAME
+             << ". They will be migrated to sharded storage on save." << endl;
+    }
+
+    // --- (These two functions are now called by the merged wrapper function) ---
+    /**
+     * [SEARCHING - Linear Search]
+     * Searches for an event by name. Matches are scanned in name order
+     * and shown a page at a time.
+     */
+    void searchEventByName() {
+        string nameQuery;
+        cout << "\n--- Search Event by Name ---\n";
+        cout << "Enter Event Name (or part of it): ";
+        getline(cin, nameQuery);
+
+        ensureAllShardsLoaded();
+
+        ostringstream header;
+        header << left << setw(10) << "EventID"
+               << setw(30) << "Name"
+               << setw(15) << "Date"
+               << setw(20) << "Venue" << "\n";
+
+        cout << "\nSearch Results:\n";
+        browseIndex(nameOrder, header.str(),
+            [&](EventNode* event) {
+                return event->getName().find(nameQuery) != string::npos;
+            },
+            [](ostringstream& out, EventNode* event) {
+                out << left << setw(10) << event->eventID
+                    << setw(30) << event->getName()
+                    << setw(15) << event->getDate()
+                    << setw(20) << event->getVenue() << "\n";
+            });
+    }
+
+    /**
+     * [BK-TREE]
+     * Typo- and case-tolerant search. Each query word is looked up in the
+     * BK-tree; an event matches when every query word is close to one of
+     * its words, and its score is the sum of those edit distances.
+     */
+    void fuzzySearchEventByName() {
+        string nameQuery;
+        cout << "\n--- Fuzzy Search by Event Name ---\n";
+        cout << "Enter Event Name (typos are OK): ";
+        getline(cin, nameQuery);
+
+        ensureAllShardsLoaded();
+        auto startTime = chrono::steady_clock::now();
+
+        vector<string> queryWords = fuzzyKeys(nameQuery);
+        int queryLength = nameQuery.size();
+
+        // Rank words first: find the indexed words near each query word,
+        // and drive the search from the query word with the fewest events.
+        vector<vector<pair<int, int>>> wordMatches;
+        size_t driver = 0;
+        size_t driverEvents = SIZE_MAX;
+        for (size_t w = 0; w < queryWords.size(); ++w) {
+            wordMatches.push_back(nameIndex.matches(queryWords[w], fuzzyThreshold(queryWords[w])));
+            size_t events = 0;
+            for (auto& match : wordMatches.back()) events += nameIndex.itemsOf(match.second).size();
+            if (events < driverEvents) {
+                driver = w;
+                driverEvents = events;
+            }
+        }
+
+        // The indexed words close to each query word, with their distance.
+        // An event matches only if every query word has one of these among
+        // its name words, so a candidate is checked by lookups rather than
+        // by computing edit distances.
+        vector<unordered_map<string, int>> nearWords(queryWords.size());
+        for (size_t w = 0; w < queryWords.size(); ++w) {
+            for (auto& match : wordMatches[w]) {
+                nearWords[w][nameIndex.wordOf(match.second)] = match.first;
+            }
+        }
+
+        // Total typos of an event against every query word, or -1 if a
+        // query word has no close word in its name
+        auto score = [&](EventNode* event) {
+            vector<string> nameWords = fuzzyKeys(event->getName());
+            int total = 0;
+            for (const unordered_map<string, int>& near : nearWords) {
+                int best = INT_MAX;
+                for (const string& nameWord : nameWords) {
+                    auto found = near.find(nameWord);
+                    if (found != near.end()) best = min(best, found->second);
+                }
+                if (best == INT_MAX) return -1;
+                total += best;
+            }
+            return total;
+        };
+
+        // Fewest typos first; on a tie prefer names closest in length to the query
+        auto better = [queryLength](const pair<int, EventNode*>& a, const pair<int, EventNode*>& b) {
+            if (a.first != b.first) return a.first < b.first;
+            int lenA = abs((int)a.second->getName().size() - queryLength);
+            int lenB = abs((int)b.second->getName().size() - queryLength);
+            if (lenA != lenB) return lenA < lenB;
+            return a.second->getName() < b.second->getName();
+        };
+
+        // Expand the driver's words nearest first, and within a word the
+        // names nearest the query length first. Every match contains a
+        // driver word, so only the driver's events are ever checked, and a
+        // word stops once it has given k matches with no extra typos.
+        vector<pair<int, EventNode*>> ranked;
+        unordered_set<EventNode*> seen;
+        size_t k = FUZZY_TOP_K;
+        const vector<pair<int, int>> noWords;
+        for (auto& match : queryWords.empty() ? noWords : wordMatches[driver]) {
+            // Every remaining event has at least match.first typos
+            if (ranked.size() >= k) {
+                partial_sort(ranked.begin(), ranked.begin() + k, ranked.end(), better);
+                ranked.resize(k);
+                if (ranked.back().first < match.first) break;
+            }
+
+            const auto& items = nameIndex.itemsOf(match.second);
+            auto above = items.lower_bound({queryLength, nullptr});
+            auto below = above;
+            size_t goodEnough = 0; // Matches from this word with no extra typos
+            while (goodEnough < k && (below != items.begin() || above != items.end())) {
+                bool takeAbove = above != items.end()
+                    && (below == items.begin() || above->first - queryLength <= queryLength - prev(below)->first);
+                EventNode* event = takeAbove ? (above++)->second : (--below)->second;
+                if (!seen.insert(event).second) continue;
+
+                int typos = score(event);
+                if (typos < 0) continue;
+                ranked.push_back({typos, event});
+                if (typos <= match.first) goodEnough++;
+            }
+        }
+
+        k = min(k, ranked.size());
+        partial_sort(ranked.begin(), ranked.begin() + k, ranked.end(), better);
+        ranked.resize(k);
+
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+
+        cout << "\nTop " << FUZZY_TOP_K << " Matches:\n";
+        cout << "------------------------------------------------------------------\n";
+        cout << left << setw(8) << "Typos"
+             << setw(10) << "EventID"
+             << setw(30) << "Name"
+             << setw(15) << "Date" << "\n";
+        cout << "------------------------------------------------------------------\n";
+
+        for (auto& match : ranked) {
+            cout << left << setw(8) << match.first
+                 << setw(10) << match.second->eventID
+                 << setw(30) << match.second->getName()
+                 << setw(15) << match.second->getDate() << "\n";
+        }
+        if (ranked.empty()) {
+            cout << "No events found matching that name.\n";
+        }
+        cout << "------------------------------------------------------------------\n";
+        cout << "(Search took " << fixed << setprecision(3) << ms << " ms)\n";
+        cout.unsetf(ios::fixed);
+        cout << setprecision(6);
+    }
+
+    /**
+     * [SORTING]
+     * Displays all events, sorted alphabetically by name.
+     */
+    void viewEventsSortedByName() {
+        cout << "\n--- All Events (Sorted by Name) ---\n";
+        ensureAllShardsLoaded();
+
+        if (nameOrder.empty()) {
+            cout << "No events in the system yet.\n";
+            return;
+        }
+
+        ostringstream header;
+        header << left << setw(30) << "Name"
+               << setw(10) << "EventID"
+               << setw(15) << "Date"
+               << setw(20) << "Venue" << "\n";
+
+        browseIndex(nameOrder, header.str(),
+            [](EventNode*) { return true; },
+            [](ostringstream& out, EventNode* event) {
+                out << left << setw(30) << event->getName()
+                    << setw(10) << event->eventID
+                    << setw(15) << event->getDate()
+                    << setw(20) << event->getVenue() << "\n";
+            });
+    }
+
+    /**
+     * [SORTING]
+     * Displays all events, sorted by date.
+     */
+    void viewEventsSortedByDate() {
+        cout << "\n--- All Events (Sorted by Date) ---\n";
+        ensureAllShardsLoaded();
+
+        if (dateOrder.empty()) {
+            cout << "No events in the system yet.\n";
+            return;
+        }
+
+        ostringstream header;
+        header << left << setw(15) << "Date"
+               << setw(30) << "Name"
+               << setw(10) << "EventID"
+               << setw(20) << "Venue" << "\n";
+
+        browseIndex(dateOrder, header.str(),
+            [](EventNode*) { return true; },
+            [](ostringstream& out, EventNode* event) {
+                out << left << setw(15) << event->getDate()
+                    << setw(30) << event->getName()
+                    << setw(10) << event->eventID
+                    << setw(20) << event->getVenue() << "\n";
+            });
+    }
+
+    /**
+     * [PAGINATION]
+     * Pages through an event's attendee list. The cursor is where the
+     * page starts, so moving forward never re-walks earlier pages.
+     */
+    void browseAttendees(EventNode* event) {
+        typedef typename AttendeePolicy::Cursor Cursor;
+        const typename AttendeePolicy::List& list = event->attendees;
+
+        if (AttendeePolicy::atEnd(list, AttendeePolicy::first(list))) {
+            cout << "  (No attendees registered yet)\n";
+            cout << "----------------------------------------\n";
+            return;
+        }
+
+        Cursor pageStart = AttendeePolicy::first(list);
+        int firstNumber = 1;
+        vector<Cursor> earlierPages;
+
+        while (true) {
+            ostringstream page;
+            Cursor att = pageStart;
+            int count = firstNumber;
+            for (int shown = 0; !AttendeePolicy::atEnd(list, att) && shown < PAGE_SIZE; ++shown) {
+                const StudentRecord& student = students.get(AttendeePolicy::handle(list, att));
+                page << "  " << count << ". " << student.studentName << " (ID: " << student.studentID << ")\n";
+                att = AttendeePolicy::next(list, att);
+                count++;
+            }
+            page << "----------------------------------------\n";
+
+            bool hasNext = !AttendeePolicy::atEnd(list, att);
+            bool hasPrev = !earlierPages.empty();
+            if (hasNext || hasPrev) {
+                page << "Attendees " << firstNumber << "-" << count - 1 << "\n";
+            }
+
+            string text = page.str();
+            cout.write(text.data(), text.size());
+            cout.flush();
+
+            if (!hasNext && !hasPrev) return;
+
+            string command;
+            cout << "[" << (hasNext ? "n = next, " : "") << (hasPrev ? "p = previous, " : "") << "q = quit]: ";
+            if (!getline(cin, command) || command.empty()) return;
+
+            char c = tolower((unsigned char)command[0]);
+            if (c == 'n' && hasNext) {
+                earlierPages.push_back(pageStart);
+                pageStart = att;
+                firstNumber += PAGE_SIZE;
+            } else if (c == 'p' && hasPrev) {
+                pageStart = earlierPages.back();
+                earlierPages.pop_back();
+                firstNumber -= PAGE_SIZE;
+            } else if (c == 'q') {
+                return;
+            }
+        }
+    }
+
+    enum RegisterResult { REGISTERED, EVENT_NOT_FOUND, NAME_CONFLICT, ALREADY_REGISTERED };
+
+    /**
+     * [LINKED LIST]
+     * Adds one student to an event, reusing their identity if they
+     * registered for anything before.
+     */
+    RegisterResult registerStudentAt(EventNode* event, const string& studentID, const string& studentName) {
+        ensureStudentsLoaded();
+        int handle = students.intern(studentID, studentName);
+        if (handle == -1) return NAME_CONFLICT;
+
+        bool alreadyRegistered = false;
+        forEachAttendee(event, [&](int registered) {
+            if (registered == handle) alreadyRegistered = true;
+        });
+        if (alreadyRegistered) {
+            students.release(handle);
+            return ALREADY_REGISTERED;
+        }
+
+        AttendeePolicy::pushFront(event->attendees, handle);
+        event->attendeeCount++;
+        markDirty(event->eventID);
+
+        Operation op(Operation::REGISTER, event->eventID);
+        op.registered = 1;
+        recordOperation(move(op), event);
+        return REGISTERED;
+    }
+
+    // --- UNDO / REDO AND AUDIT HISTORY ---
+
+    /**
+     * Packs the visible state of an event as "name;date;venue;attendees"
+     * for ADD/DELETE audit lines.
+     */
+    string packEventState(EventNode* event) {
+        return event->getName() + ";" + event->getDate() + ";" + event->getVenue() + ";" + to_string(event->attendeeCount);
+    }
+
+    /**
+     * Queues one audit line: "time|KIND|eventID|before|after".
+     */
+    void audit(const string& kind, const string& eventID, const string& before, const string& after) {
+        pendingAudit.push_back(to_string(time(nullptr)) + "|" + kind + "|" + eventID + "|" + before + "|" + after);
+    }
+
+    /**
+     * Audits the effect of an operation, or of its inverse when undoing.
+     */
+    void auditOperation(const Operation& op, EventNode* event, bool inverse) {
+        switch (op.kind) {
+            case Operation::ADD_EVENT:
+            case Operation::DELETE_EVENT: {
+                bool added = (op.kind == Operation::ADD_EVENT) != inverse;
+                string state = packEventState(event);
+                audit(added ? "ADD" : "DELETE", op.eventID, added ? "" : state, added ? state : "");
+                break;
+            }
+            case Operation::UPDATE_NAME:
+            case Operation::UPDATE_DATE:
+            case Operation::UPDATE_VENUE: {
+                const char* kind = op.kind == Operation::UPDATE_NAME ? "NAME"
+                                 : op.kind == Operation::UPDATE_DATE ? "DATE" : "VENUE";
+                audit(kind, op.eventID, inverse ? op.after : op.before, inverse ? op.before : op.after);
+                break;
+            }
+            case Operation::REGISTER: {
+                int delta = op.registered + op.undoneStudents.size();
+                audit("REGISTER", op.eventID, "", to_string(inverse ? -delta : delta));
+                break;
+            }
+        }
+    }
+
+    void releaseOperation(Operation& op) {
+        if (op.detached != nullptr) {
+            deleteEventNode(op.detached);
+            op.detached = nullptr;
+        }
+    }
+
+    /**
+     * Pushes a change that has already been applied. Any redo history is
+     * dropped, and the oldest step is discarded whole once the limit is hit.
+     */
+    void recordOperation(Operation op, EventNode* event) {
+        auditOperation(op, event, false);
+
+        for (Operation& stale : redoStack) releaseOperation(stale);
+        redoStack.clear();
+
+        if (!op.continuesPrevious) undoSteps++;
+        undoStack.push_back(move(op));
+        while (undoSteps > HISTORY_LIMIT) {
+            do {
+                releaseOperation(undoStack.front());
+                undoStack.pop_front();
+            } while (!undoStack.empty() && undoStack.front().continuesPrevious);
+            undoSteps--;
+        }
+    }
+
+    void replaceString(typename EventNode::Str& field, const string& value) {
+        typename EventNode::Str old = field;
+        field = StringPolicy::make(strings, value);
+        StringPolicy::release(strings, old);
+    }
+
+    /**
+     * Sets one field, keeping the name index and sortable date in step.
+     */
+    void setEventField(EventNode* event, OperationKind::Kind kind, const string& value) {
+        if (kind == Operation::UPDATE_NAME) {
+            unindexEventName(event);
+            nameOrder.erase({event->getName(), event->eventID});
+            replaceString(event->eventName, value);
+            indexEventName(event);
+            nameOrder[{event->getName(), event->eventID}] = event;
+        } else if (kind == Operation::UPDATE_DATE) {
+            OrderedIndex& atVenue = eventsByVenue[venueID(event->getVenue())];
+            dateOrder.erase({event->getSortableDate(), event->eventID});
+            atVenue.erase({event->getSortableDate(), event->eventID});
+            replaceString(event->date, value);
+            replaceString(event->sortableDate, toSortableDate(value));
+            dateOrder[{event->getSortableDate(), event->eventID}] = event;
+            atVenue[{event->getSortableDate(), event->eventID}] = event;
+        } else {
+            eventsByVenue[venueID(event->getVenue())].erase({event->getSortableDate(), event->eventID});
+            replaceString(event->venue, value);
+            eventsByVenue[venueID(event->getVenue())][{event->getSortableDate(), event->eventID}] = event;
+        }
+        markDirty(event->eventID);
+    }
+
+    /**
+     * Reverts (inverse = true) or re-applies an operation in O(1), apart
+     * from REGISTER which touches one node per student it added.
+     */
+    void applyOperation(Operation& op, bool inverse) {
+        bool shouldExist = (op.kind == Operation::ADD_EVENT) != inverse;
+
+        if (op.kind == Operation::ADD_EVENT || op.kind == Operation::DELETE_EVENT) {
+            if (shouldExist) {
+                EventNode* event = op.detached;
+                op.detached = nullptr;
+                ensureShardLoaded(shardFunction(event->eventID));
+                insertEvent(event);
+                markDirty(event->eventID);
+                auditOperation(op, event, inverse);
+            } else {
+                op.detached = unlinkEvent(op.eventID);
+                auditOperation(op, op.detached, inverse);
+            }
+            return;
+        }
+
+        EventNode* event = findEvent(op.eventID);
+        if (event == nullptr) return; // Cannot happen while the stacks stay in order
+
+        if (op.kind == Operation::REGISTER) {
+            if (inverse) {
+                // These were linked at the head, so they are the first nodes.
+                // Their students are kept by ID and name while undone, as a
+                // handle nobody refers to is freed and may be reused.
+                for (int i = 0; i < op.registered && event->attendeeCount > 0; ++i) {
+                    int handle = AttendeePolicy::handle(event->attendees, AttendeePolicy::first(event->attendees));
+                    StudentRecord student = students.get(handle);
+                    op.undoneStudents.emplace_back(student.studentID, student.studentName);
+                    students.release(handle);
+                    AttendeePolicy::popFront(event->attendees);
+                    event->attendeeCount--;
+                }
+                reverse(op.undoneStudents.begin(), op.undoneStudents.end()); // Popped newest first
+                op.registered = 0;
+            } else {
+                for (const pair<string, string>& student : op.undoneStudents) {
+                    // Nothing new registers while a redo is pending, so the
+                    // name cannot conflict
+                    int handle = students.intern(student.first, student.second);
+                    if (handle == -1) continue;
+                    AttendeePolicy::pushFront(event->attendees, handle);
+                    event->attendeeCount++;
+                    op.registered++;
+                }
+                op.undoneStudents.clear();
+            }
+            markDirty(op.eventID);
+        } else {
+            setEventField(event, op.kind, inverse ? op.before : op.after);
+        }
+        auditOperation(op, event, inverse);
+    }
+
+    /**
+     * Parses "DD/MM/YYYY HH:MM" as local time. Returns -1 if invalid.
+     */
+    time_t parseDateTime(const string& text) {
+        if (text.size() != 16 || text[10] != ' ' || text[13] != ':') return -1;
+        string datePart = text.substr(0, 10);
+        if (!isValidDate(datePart) || !isdigit(text[11]) || !isdigit(text[12])
+            || !isdigit(text[14]) || !isdigit(text[15])) return -1;
+
+        tm parts = {};
+        parts.tm_mday = stoi(text.substr(0, 2));
+        parts.tm_mon = stoi(text.substr(3, 2)) - 1;
+        parts.tm_year = stoi(text.substr(6, 4)) - 1900;
+        parts.tm_hour = stoi(text.substr(11, 2));
+        parts.tm_min = stoi(text.substr(14, 2));
+        parts.tm_sec = 59; // Include everything that happened during that minute
+        parts.tm_isdst = -1;
+        if (parts.tm_hour > 23 || parts.tm_min > 59) return -1;
+        return mktime(&parts);
+    }
+
+    string formatTime(time_t when) {
+        char text[32];
+        strftime(text, sizeof(text), "%d/%m/%Y %H:%M:%S", localtime(&when));
+        return text;
+    }
+
+    struct AuditEntry {
+        time_t when;
+        string kind, eventID, before, after;
+    };
+
+    /**
+     * Reads the saved audit trail of one event, followed by the entries
+     * from this session that have not been saved yet.
+     */
+    vector<AuditEntry> loadAuditTrail(const string& eventID) {
+        vector<AuditEntry> entries;
+        auto parse = [&](const string& line) {
+            stringstream ss(line);
+            AuditEntry entry;
+            string when;
+            getline(ss, when, '|');
+            getline(ss, entry.kind, '|');
+            getline(ss, entry.eventID, '|');
+            if (entry.eventID != eventID) return;
+            getline(ss, entry.before, '|');
+            getline(ss, entry.after, '|');
+            try {
+                entry.when = stoll(when);
+            } catch (...) {
+                return;
+            }
+            entries.push_back(entry);
+        };
+
+        ifstream inFile(HISTORY_FILE);
+        string line;
+        while (getline(inFile, line)) parse(line);
+        for (const string& pending : pendingAudit) parse(pending);
+        return entries;
+    }
+
+    /**
+     * Appends this session's audit lines to the history file.
+     */
+    void saveAuditTrail() {
+        if (pendingAudit.empty()) return;
+        ofstream outFile(HISTORY_FILE, ios::app);
+        if (!outFile) {
+            cerr << "Error: Could not open " << HISTORY_FILE << " for writing." << endl;
+            return;
+        }
+        for (const string& line : pendingAudit) {
+            outFile << line << "\n";
+        }
+        outFile.close();
+        pendingAudit.clear();
+    }
+
+    /**
+     * [FILE HANDLING]
+     * Writes both stacks to UNDO_FILE, oldest entry first, so undo and
+     * redo survive a restart. Each entry is a header line
+     * "OP|U or R|kind|continues|eventID|registered|lines" followed by
+     * that many lines: the old and new value of an update, the students
+     * of an undone registration, or the saved block of a detached event.
+     */
+    void saveOperationLog() {
+        if (undoStack.empty() && redoStack.empty()) {
+            remove(UNDO_FILE.c_str());
+            return;
+        }
+        ofstream outFile(UNDO_FILE);
+        if (!outFile) {
+            cerr << "Error: Could not open " << UNDO_FILE << " for writing." << endl;
+            return;
+        }
+        auto writeEntry = [&](const Operation& op, char stack) {
+            string lines;
+            if (op.detached != nullptr) {
+                lines = formatEventRecord(op.detached);
+            } else if (op.kind == Operation::REGISTER) {
+                for (const pair<string, string>& student : op.undoneStudents) {
+                    lines += student.first + "|" + student.second + "\n";
+                }
+            } else if (op.kind != Operation::ADD_EVENT && op.kind != Operation::DELETE_EVENT) {
+                lines = op.before + "\n" + op.after + "\n";
+            }
+            outFile << "OP|" << stack << "|" << Operation::name(op.kind) << "|" << op.continuesPrevious << "|"
+                    << op.eventID << "|" << op.registered << "|" << count(lines.begin(), lines.end(), '\n') << "\n"
+                    << lines;
+        };
+        for (const Operation& op : undoStack) writeEntry(op, 'U');
+        for (const Operation& op : redoStack) writeEntry(op, 'R');
+    }
+
+    /**
+     * Rebuilds a detached event from its saved block, or returns nullptr
+     * if the block is malformed or fails its checksum.
+     */
+    EventNode* parseEventRecord(const vector<string>& lines) {
+        string_view fields[6];
+        if (lines.size() < 2 || !isEventLine(lines[0], fields)) return nullptr;
+
+        uint32_t crc = 0;
+        for (size_t i = 0; i + 1 < lines.size(); ++i) {
+            crc = CRC32C::extend(crc, lines[i]);
+            crc = CRC32C::extend(crc, "\n", 1);
+        }
+        if (lines.back() != "END_EVENT|" + CRC32C::toHex(crc)) return nullptr;
+
+        EventNode* event = new EventNode(strings, string(fields[0]), string(fields[1]), string(fields[2]),
+                                         string(fields[3]), string(fields[4]));
+        vector<int> handles;
+        for (size_t i = 1; i + 1 < lines.size(); ++i) {
+            if (splitFields(lines[i], fields, 2) != 2) continue; // Covered by the checksum
+            string studentID(fields[0]);
+            int handle = students.find(studentID);
+            if (handle == -1) handle = students.intern(studentID, string(fields[1]));
+            else students.retain(handle);
+            handles.push_back(handle);
+        }
+        AttendeePolicy::assign(event->attendees, handles);
+        event->attendeeCount = handles.size();
+        return event;
+    }
+
+    /**
+     * [FILE HANDLING]
+     * Restores the stacks written by saveOperationLog. Entries only make
+     * sense in order, so a log that cannot be read in full is ignored.
+     */
+    void loadOperationLog() {
+        ifstream inFile(UNDO_FILE);
+        if (!inFile) return;
+        ensureStudentsLoaded();
+
+        deque<Operation> undo, redo;
+        string line, problem;
+        string_view fields[8];
+        int lineNo = 0;
+        while (problem.empty() && getline(inFile, line)) {
+            lineNo++;
+            if (line.empty()) continue;
+
+            int kind = -1, registered = 0, lineCount = 0;
+            if (splitFields(line, fields, 7) == 7 && fields[0] == "OP" && (fields[1] == "U" || fields[1] == "R")) {
+                for (int k = OperationKind::ADD_EVENT; k <= OperationKind::REGISTER; ++k) {
+                    if (fields[2] == OperationKind::name((OperationKind::Kind)k)) kind = k;
+                }
+                try {
+                    registered = stoi(string(fields[5]));
+                    lineCount = stoi(string(fields[6]));
+                } catch (...) {
+                    kind = -1;
+                }
+            }
+            if (kind == -1 || registered < 0 || lineCount < 0) {
+                problem = "malformed entry";
+                break;
+            }
+
+            Operation op((OperationKind::Kind)kind, string(fields[4]));
+            op.continuesPrevious = fields[3] == "1";
+            op.registered = registered;
+            deque<Operation>& stack = fields[1] == "U" ? undo : redo;
+
+            vector<string> lines(lineCount);
+            for (string& payload : lines) {
+                if (!getline(inFile, payload)) problem = "file ends inside an entry";
+                lineNo++;
+            }
+            if (!problem.empty()) break;
+
+            if (kind == Operation::REGISTER) {
+                for (const string& student : lines) {
+                    if (splitFields(student, fields, 2) != 2) problem = "malformed student line";
+                    else op.undoneStudents.emplace_back(string(fields[0]), string(fields[1]));
+                }
+            } else if (kind == Operation::ADD_EVENT || kind == Operation::DELETE_EVENT) {
+                if (!lines.empty()) {
+                    op.detached = parseEventRecord(lines);
+                    if (op.detached == nullptr) problem = "damaged event block";
+                }
+            } else if (lines.size() == 2) {
+                op.before = lines[0];
+                op.after = lines[1];
+            } else {
+                problem = "update without its two values";
+            }
+            stack.push_back(move(op));
+        }
+
+        if (!problem.empty()) {
+            cout << "[System] Warning: " << UNDO_FILE << " line " << lineNo << ": " << problem
+                 << ". Undo history from the last session was not restored." << endl;
+            for (Operation& op : undo) releaseOperation(op);
+            for (Operation& op : redo) releaseOperation(op);
+            return;
+        }
+        undoStack = move(undo);
+        redoStack = move(redo);
+        undoSteps = count_if(undoStack.begin(), undoStack.end(),
+                             [](const Operation& op) { return !op.continuesPrevious; });
+    }
+
+    void undoLastChange() {
+        if (undoStack.empty()) {
+            cout << "Nothing to undo.\n";
+            return;
+        }
+        int undone = 0;
+        bool more = true;
+        while (more && !undoStack.empty()) {
+            Operation op = move(undoStack.back());
+            undoStack.pop_back();
+            applyOperation(op, true);
+            more = op.continuesPrevious;
+            redoStack.push_back(move(op));
+            undone++;
+        }
+        undoSteps--;
+        cout << "Success! Undid " << undone << " change(s).\n";
+    }
+
+    void redoLastChange() {
+        if (redoStack.empty()) {
+            cout << "Nothing to redo.\n";
+            return;
+        }
+        int redone = 0;
+        do {
+            Operation op = move(redoStack.back());
+            redoStack.pop_back();
+            applyOperation(op, false);
+            undoStack.push_back(move(op));
+            redone++;
+        } while (!redoStack.empty() && redoStack.back().continuesPrevious);
+        undoSteps++;
+        cout << "Success! Redid " << redone << " change(s).\n";
+    }
+
+    void showEventHistory(const string& eventID) {
+        vector<AuditEntry> entries = loadAuditTrail(eventID);
+        cout << "\nHistory of " << eventID << ":\n";
+        cout << "------------------------------------------------------------------\n";
+        if (entries.empty()) {
+            cout << "  (No recorded changes)\n";
+        }
+        for (const AuditEntry& entry : entries) {
+            cout << "  " << formatTime(entry.when) << "  " << left << setw(9) << entry.kind;
+            if (entry.kind == "REGISTER") {
+                cout << entry.after << " attendee(s)";
+            } else if (entry.kind == "ADD") {
+                cout << entry.after;
+            } else if (entry.kind == "DELETE") {
+                cout << entry.before;
+            } else {
+                cout << "'" << entry.before << "' -> '" << entry.after << "'";
+            }
+            cout << "\n";
+        }
+        cout << "------------------------------------------------------------------\n";
+    }
+
+    /**
+     * [TIME TRAVEL]
+     * Starts from the current state and walks the audit trail backwards,
+     * undoing every change made after the requested time.
+     */
+    void showEventAtTime(const string& eventID, time_t when) {
+        EventNode* event = findEvent(eventID);
+        bool exists = (event != nullptr);
+        string name, date, venue;
+        int attendees = 0;
+        if (exists) {
+            name = event->getName();
+            date = event->getDate();
+            venue = event->getVenue();
+            attendees = event->attendeeCount;
+        }
+
+        vector<AuditEntry> entries = loadAuditTrail(eventID);
+        for (auto it = entries.rbegin(); it != entries.rend() && it->when > when; ++it) {
+            if (it->kind == "ADD") {
+                exists = false;
+            } else if (it->kind == "DELETE") {
+                exists = true;
+                stringstream ss(it->before);
+                string count;
+                getline(ss, name, ';');
+                getline(ss, date, ';');
+                getline(ss, venue, ';');
+                getline(ss, count, ';');
+                attendees = count.empty() ? 0 : stoi(count);
+            } else if (it->kind == "NAME") {
+                name = it->before;
+            } else if (it->kind == "DATE") {
+                date = it->before;
+            } else if (it->kind == "VENUE") {
+                venue = it->before;
+            } else if (it->kind == "REGISTER") {
+                attendees -= stoi(it->after);
+            }
+        }
 
-        while (getline(inFile, line)) {
-            if (line.empty()) continue;
+        cout << "\n----------------------------------------\n";
+        cout << "Event " << eventID << " as of " << formatTime(when) << ":\n";
+        if (!exists) {
+            cout << "  (Did not exist at that time)\n";
+        } else {
+            cout << "Name:        " << name << "\n";
+            cout << "Date:        " << date << "\n";
+            cout << "Venue:       " << venue << "\n";
+            cout << "Attendees:   " << attendees << "\n";
+        }
+        cout << "----------------------------------------\n";
+    }
 
-            if (line == "END_EVENT") {
-                currentEvent = nullptr;
-                continue;
+    /**
+     * [FILE HANDLING]
+     * Walks the hash index once and streams events, attendees and
+     * per-event registration counts to three files. Memory use is bounded
+     * by the writer buffers, not by the size of the store.
+     */
+    string runExport(bool asJson) {
+        auto startTime = chrono::steady_clock::now();
+        string ext = asJson ? ".jsonl" : ".csv";
+
+        BufferedWriter events("export_events" + ext);
+        BufferedWriter attendees("export_attendees" + ext);
+        BufferedWriter counts("export_counts" + ext);
+        if (!events.isOpen() || !attendees.isOpen() || !counts.isOpen()) {
+            return "Error: Could not open export files for writing.";
+        }
+
+        if (!asJson) {
+            events.write("eventID,eventName,date,venue\n");
+            attendees.write("eventID,studentID,studentName\n");
+            counts.write("eventID,eventName,registrations\n");
+        }
+
+        long long totalEvents = 0;
+        long long totalReg = 0;
+
+        hashTable.forEach([&](EventNode* event) {
+            totalEvents++;
+            long long count = 0;
+
+            if (asJson) {
+                events.write("{\"eventID\":");   events.writeJsonString(event->eventID);
+                events.write(",\"eventName\":"); events.writeJsonString(event->getName());
+                events.write(",\"date\":");      events.writeJsonString(event->getDate());
+                events.write(",\"venue\":");     events.writeJsonString(event->getVenue());
+                events.write("}\n");
+            } else {
+                events.writeCsvField(event->eventID);    events.put(',');
+                events.writeCsvField(event->getName());  events.put(',');
+                events.writeCsvField(event->getDate());  events.put(',');
+                events.writeCsvField(event->getVenue()); events.put('\n');
             }
 
-            stringstream ss(line);
-            string field1, field2, field3, field4, field5; // Added field5
-
-            // Parse the line. A pipe '|' is our delimiter.
-            getline(ss, field1, '|');
-            getline(ss, field2, '|');
-            getline(ss, field3, '|');
-            getline(ss, field4, '|');
-            getline(ss, field5, '|'); // Read the 5th field (sortableDate)
-
-            if (!field5.empty()) { // Check for the 5th field now
-                // This line has 5 fields, so it's an Event line
-                currentEvent = new EventNode(field1, field2, field3, field4, field5); // Use 5-arg constructor
-                int index = hashFunction(currentEvent->eventID);
-                
-                currentEvent->next = hashTable[index];
-                hashTable[index] = currentEvent;
-                
-            } else if (currentEvent != nullptr && !field2.empty()) {
-                
-                AttendeeNode* newAttendee = new AttendeeNode(field1, field2);
-                
-                if (currentEvent->attendeeHead == nullptr) {
-                    currentEvent->attendeeHead = newAttendee;
+            forEachAttendee(event, [&](int handle) {
+                const StudentRecord& student = students.get(handle);
+                count++;
+                if (asJson) {
+                    attendees.write("{\"eventID\":");     attendees.writeJsonString(event->eventID);
+                    attendees.write(",\"studentID\":");   attendees.writeJsonString(student.studentID);
+                    attendees.write(",\"studentName\":"); attendees.writeJsonString(student.studentName);
+                    attendees.write("}\n");
                 } else {
-                    AttendeeNode* temp = currentEvent->attendeeHead;
-                    while (temp->next != nullptr) {
-                        temp = temp->next;
-                    }
-                    temp->next = newAttendee;
+                    attendees.writeCsvField(event->eventID);       attendees.put(',');
+                    attendees.writeCsvField(student.studentID);    attendees.put(',');
+                    attendees.writeCsvField(student.studentName);  attendees.put('\n');
                 }
+            });
+            totalReg += count;
+
+            if (asJson) {
+                counts.write("{\"eventID\":");    counts.writeJsonString(event->eventID);
+                counts.write(",\"eventName\":");  counts.writeJsonString(event->getName());
+                counts.write(",\"registrations\":"); counts.writeNumber(count);
+                counts.write("}\n");
+            } else {
+                counts.writeCsvField(event->eventID);   counts.put(',');
+                counts.writeCsvField(event->getName()); counts.put(',');
+                counts.writeNumber(count);              counts.put('\n');
             }
+        });
+
+        // A full disk shows up here, not as a short export reported as success
+        string failed;
+        if (!events.close()) failed = "export_events" + ext + " (" + strerror(events.lastError()) + ")";
+        else if (!attendees.close()) failed = "export_attendees" + ext + " (" + strerror(attendees.lastError()) + ")";
+        else if (!counts.close()) failed = "export_counts" + ext + " (" + strerror(counts.lastError()) + ")";
+        if (!failed.empty()) {
+            return "Error: Could not write " + failed + ". The export is incomplete.";
         }
-        inFile.close();
-        cout << "[System] Successfully loaded events from " << FILENAME << endl;
+
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+        ostringstream message;
+        message << "[Export] Wrote " << totalEvents << " events and " << totalReg
+                << " registrations to export_*" << ext << " in " << fixed << setprecision(3)
+                << seconds << " s";
+        return message.str();
     }
 
-    // --- (These two functions are now called by the merged wrapper function) ---
     /**
-     * [SEARCHING - Linear Search]
-     * Searches for an event by name.
+     * Waits for a background export so the store is not modified while
+     * it is being read, then prints its summary.
      */
-    void searchEventByName() {
-        string nameQuery;
-        cout << "\n--- Search Event by Name ---\n";
-        cout << "Enter Event Name (or part of it): ";
-        getline(cin, nameQuery);
+    void finishPendingExport() {
+        if (exportThread.joinable()) {
+            exportThread.join();
+            cout << "\n" << exportMessage << endl;
+            exportFinished = false;
+        }
+    }
 
-        bool found = false;
-        cout << "\nSearch Results:\n";
-        cout << "------------------------------------------------------------------\n";
-        cout << left << setw(10) << "EventID"
-             << setw(30) << "Name"
-             << setw(15) << "Date"
-             << setw(20) << "Venue" << "\n";
-        cout << "------------------------------------------------------------------\n";
 
-        for (int i = 0; i < TABLE_SIZE; ++i) {
-            EventNode* current = hashTable[i];
-            while (current != nullptr) {
-                if (current->eventName.find(nameQuery) != string::npos) {
-                    cout << left << setw(10) << current->eventID
-                         << setw(30) << current->eventName
-                         << setw(15) << current->date
-                         << setw(20) << current->venue << "\n";
-                    found = true;
-                }
-                current = current->next;
-            }
-        }
+public:
+    /**
+     * Initializes the hash table and loads data from the file.
+     */
+    EventTracker(int size = 10, const string& storageName = "events") : hashTable(size) {
 
-        if (!found) {
-            cout << "No events found matching that name.\n";
-        }
-        cout << "------------------------------------------------------------------\n";
+        // All files share the storage name, e.g. events_shard_3.txt
+        FILENAME = storageName + ".txt";
+        SHARD_PREFIX = storageName + "_shard_";
+        MANIFEST_FILE = storageName + "_shards.txt";
+        HISTORY_FILE = storageName + "_history.log";
+        UNDO_FILE = storageName + "_undo.txt";
+        STUDENTS_FILE = storageName + "_students.txt";
+
+        // [File Handling]
+        loadEventsFromFile();
+        loadOperationLog();
     }
 
     /**
-     * [SORTING]
-     * Displays all events, sorted alphabetically by name.
+     * Destructor
      */
-    void viewEventsSortedByName() {
-        cout << "\n--- All Events (Sorted by Name) ---\n";
+    ~EventTracker() {
+        finishPendingExport();
+        for (Operation& op : undoStack) releaseOperation(op);
+        for (Operation& op : redoStack) releaseOperation(op);
+        hashTable.forEach([this](EventNode* event) { deleteEventNode(event); });
+    }
 
-        vector<EventNode*> allEvents;
-        for (int i = 0; i < TABLE_SIZE; ++i) {
-            EventNode* current = hashTable[i];
-            while (current != nullptr) {
-                allEvents.push_back(current);
-                current = current->next;
-            }
-        }
+    // --- Programmatic API (used by the benchmark harness) ---
 
-        if (allEvents.empty()) {
-            cout << "No events in the system yet.\n";
-            return;
+    /**
+     * Adds an already validated event. Returns false if the ID is taken.
+     */
+    bool createEvent(const string& id, const string& name, const string& date, const string& venue) {
+        if (findEvent(id) != nullptr) return false;
+
+        // Convert date to sortable format
+        string sort_dt = toSortableDate(date);
+
+        EventNode* newNode = new EventNode(strings, id, name, date, venue, sort_dt);
+
+        insertEvent(newNode);
+        markDirty(id);
+        recordOperation(Operation(Operation::ADD_EVENT, id), newNode);
+        return true;
+    }
+
+    bool registerStudent(const string& eventID, const string& studentID, const string& studentName) {
+        EventNode* event = findEvent(eventID);
+        return event != nullptr && registerStudentAt(event, studentID, studentName) == REGISTERED;
+    }
+
+    bool hasEvent(const string& eventID) {
+        return findEvent(eventID) != nullptr;
+    }
+
+    /**
+     * Deletes an event, keeping it in the undo history.
+     */
+    bool removeEvent(const string& eventID) {
+        EventNode* event = unlinkEvent(eventID);
+        if (event == nullptr) return false;
+
+        Operation op(Operation::DELETE_EVENT, eventID);
+        op.detached = event;
+        recordOperation(move(op), event);
+        return true;
+    }
+
+    /**
+     * Walks every attendee of every event.
+     */
+    long long countRegistrations() {
+        ensureAllShardsLoaded();
+        long long total = 0;
+        hashTable.forEach([&](EventNode* event) {
+            forEachAttendee(event, [&](int) { total++; });
+        });
+        return total;
+    }
+
+    /**
+     * Registrations at one venue, read from the venue index.
+     */
+    long long venueRegistrations(const string& venue) {
+        ensureAllShardsLoaded();
+        int v = findVenue(venue);
+        if (v == -1) return 0;
+
+        long long total = 0;
+        for (const auto& entry : eventsByVenue[v]) {
+            total += entry.second->attendeeCount;
         }
+        return total;
+    }
 
-        insertionSort(allEvents); // Sorts by name
+    vector<string> listEventIDs() {
+        ensureAllShardsLoaded();
+        vector<string> ids;
+        hashTable.forEach([&](EventNode* event) { ids.push_back(event->eventID); });
+        return ids;
+    }
 
-        cout << "------------------------------------------------------------------\n";
-        cout << left << setw(30) << "Name"
-             << setw(10) << "EventID"
-             << setw(15) << "Date"
-             << setw(20) << "Venue" << "\n";
-        cout << "------------------------------------------------------------------\n";
+    /**
+     * The saved form of one event block, or "" if the event does not exist.
+     */
+    string eventRecord(const string& eventID) {
+        EventNode* event = findEvent(eventID);
+        return event == nullptr ? "" : formatEventRecord(event);
+    }
 
-        for (EventNode* event : allEvents) {
-            cout << left << setw(30) << event->eventName
-                 << setw(10) << event->eventID
-                 << setw(15) << event->date
-                 << setw(20) << event->venue << "\n";
+    vector<string> shardFiles() {
+        vector<string> files;
+        for (int s = 0; s < SHARD_COUNT; ++s) {
+            files.push_back(shardFileName(s));
         }
-        cout << "------------------------------------------------------------------\n";
+        return files;
     }
 
     /**
-     * [SORTING]
-     * Displays all events, sorted by date.
+     * Every file this tracker may create, including quarantined blocks.
      */
-    void viewEventsSortedByDate() {
-        cout << "\n--- All Events (Sorted by Date) ---\n";
+    vector<string> storageFiles() {
+        vector<string> files;
+        for (const string& shard : shardFiles()) {
+            files.push_back(shard);
+            files.push_back(shard + ".rejected");
+        }
+        files.push_back(MANIFEST_FILE);
+        files.push_back(HISTORY_FILE);
+        files.push_back(UNDO_FILE);
+        files.push_back(STUDENTS_FILE);
+        files.push_back(FILENAME + ".rejected");
+        return files;
+    }
 
-        vector<EventNode*> allEvents;
-        for (int i = 0; i < TABLE_SIZE; ++i) {
-            EventNode* current = hashTable[i];
-            while (current != nullptr) {
-                allEvents.push_back(current);
-                current = current->next;
+    /**
+     * [FILE HANDLING]
+     * Formats one event block: the event line, its attendees, and an
+     * END_EVENT line carrying the CRC32C of everything above it.
+     */
+    string formatEventRecord(const EventNode* event) {
+        // Save all 5 fields now
+        string block = event->eventID + "|" + event->getName() + "|" + event->getDate() + "|"
+                     + event->getVenue() + "|" + event->getSortableDate() + "\n";
+
+        forEachAttendee(event, [&](int handle) {
+            const StudentRecord& student = students.get(handle);
+            block += student.studentID;
+            block += '|';
+            block += student.studentName;
+            block += '\n';
+        });
+
+        return block + "END_EVENT|" + CRC32C::toHex(CRC32C::extend(0, block)) + "\n";
+    }
+
+    void writeEventRecord(ofstream& outFile, EventNode* event) {
+        outFile << formatEventRecord(event);
+    }
+
+    /**
+     * [FILE HANDLING]
+     * Rewrites only the shards that changed since they were loaded,
+     * then records the shard count in the manifest.
+     */
+    void saveEventsToFile() {
+        finishPendingExport();
+        int shardsWritten = 0;
+
+        // Written first, so every student in a saved shard is in the index
+        saveStudentIndex();
+
+        // Only the events of dirty shards are visited
+        for (int s = 0; s < SHARD_COUNT; ++s) {
+            if (!shardDirty[s]) continue;
+            ofstream outFile(shardFileName(s));
+            if (!outFile) {
+                cerr << "Error: Could not open " << shardFileName(s) << " for writing." << endl;
+                continue;
             }
+            for (EventNode* event : shardEvents[s]) {
+                writeEventRecord(outFile, event);
+            }
+            outFile.close();
+            shardDirty[s] = false;
+            shardsWritten++;
         }
 
-        if (allEvents.empty()) {
-            cout << "No events in the system yet.\n";
+        ofstream manifest(MANIFEST_FILE);
+        if (!manifest) {
+            cerr << "Error: Could not open " << MANIFEST_FILE << " for writing." << endl;
             return;
         }
+        manifest << SHARD_COUNT << "\n";
+        manifest.close();
 
-        insertionSortByDate(allEvents); // Sorts by date
-
-        cout << "------------------------------------------------------------------\n";
-        cout << left << setw(15) << "Date"
-             << setw(30) << "Name"
-             << setw(10) << "EventID"
-             << setw(20) << "Venue" << "\n";
-        cout << "------------------------------------------------------------------\n";
+        saveAuditTrail();
+        saveOperationLog();
 
-        for (EventNode* event : allEvents) {
-            cout << left << setw(15) << event->date
-                 << setw(30) << event->eventName
-                 << setw(10) << event->eventID
-                 << setw(20) << event->venue << "\n";
-        }
-        cout << "------------------------------------------------------------------\n";
+        cout << "\n[System] Saved " << shardsWritten << " changed shard(s) to "
+             << SHARD_PREFIX << "*.txt" << endl;
     }
 
 
-public:
     /**
-     * Initializes the hash table and loads data from the file.
+     * [HASHING + LINKED LIST]
+     * Adds a new event to the in-memory hash table..
      */
-    EventTracker(int size = 10) : TABLE_SIZE(size) {
-        
-        hashTable = new EventNode*[TABLE_SIZE];
-        
-        for (int i = 0; i < TABLE_SIZE; ++i) {
-            hashTable[i] = nullptr;
+    void addEvent() {
+        string id, name, date, venue;
+        finishPendingExport();
+        cout << "\n--- Add New Event --- \n";
+        cout << "Enter Event ID (e.g., 'TECH01'): ";
+        cin >> id;
+        clearInputBuffer();
+
+        if (!isValidID(id)) {
+            cout << "Invalid ID format. Use only letters and numbers. Aborting.\n";
+            return;
+        }
+
+        if (findEvent(id) != nullptr) {
+            cout << "Error: Event ID '" << id << "' already exists!\n";
+            return;
+        }
+
+        while(true) {
+            cout << "Enter Event Name (e.g., 'CodeFest'): ";
+            getline(cin, name);
+            if(isValidName(name)) break;
+            cout << "Invalid name. Use only letters and spaces.\n";
         }
         
-        // [File Handling]
-        loadEventsFromFile();
+        while(true) {
+            cout << "Enter Event Date (DD/MM/YYYY): ";
+            cin >> date;
+            clearInputBuffer();
+            if(isValidDate(date)) break;
+            cout << "Invalid date format. Use DD/MM/YYYY.\n";
+        }
+
+        while(true) {
+            cout << "Enter Event Venue: ";
+            getline(cin, venue);
+            if(isValidVenue(venue)) break;
+            cout << "Invalid venue. Use only letters and spaces.\n";
+        }
+
+        createEvent(id, name, date, venue);
+
+        cout << "\nSuccess! Event '" << name << "' added.\n";
+
     }
 
     /**
-     * Destructor
+     * [LINKED LIST]
+     * Registers a student for an event.
      */
-    ~EventTracker() {
-        for (int i = 0; i < TABLE_SIZE; ++i) {
-            EventNode* eventCurrent = hashTable[i];
-            while (eventCurrent != nullptr) {
-                EventNode* eventToDelete = eventCurrent;
-                eventCurrent = eventCurrent->next;
-
-                AttendeeNode* attCurrent = eventToDelete->attendeeHead;
-                while (attCurrent != nullptr) {
-                    AttendeeNode* attToDelete = attCurrent;
-                    attCurrent = attCurrent->next;
-                    delete attToDelete;
-                }
+    void registerForEvent() {
+        string eventID;
+        finishPendingExport();
+        cout << "\n--- Register for Event ---\n";
+        cout << "Enter Event ID to register for: ";
+        cin >> eventID;
+        clearInputBuffer();
 
-                delete eventToDelete;
-            }
+        EventNode* event = findEvent(eventID);
+
+        if (event == nullptr) {
+            cout << "Error: Event '" << eventID << "' not found.\n";
+            return;
         }
-        delete[] hashTable;
+
+        string studentID, studentName;
+        cout << "Found Event: " << event->getName() << "\n";
+        
+        while(true) {
+            cout << "Enter your Student ID: ";
+            cin >> studentID;
+            clearInputBuffer();
+            if(isValidID(studentID)) break;
+            cout << "Invalid ID. Use only letters and numbers.\n";
+        }
+
+        while(true) {
+            cout << "Enter your Full Name: ";
+            getline(cin, studentName);
+            if(isValidName(studentName)) break;
+            cout << "Invalid name. Use only letters and spaces.\n";
+        }
+
+        RegisterResult result = registerStudentAt(event, studentID, studentName);
+        if (result == NAME_CONFLICT) {
+            cout << "Error: Student ID '" << studentID << "' is already registered as '"
+                 << students.get(students.find(studentID)).studentName << "'.\n";
+            return;
+        }
+        if (result == ALREADY_REGISTERED) {
+            cout << "Error: " << studentName << " is already registered for " << event->getName() << ".\n";
+            return;
+        }
+
+        cout << "\nSuccess! " << studentName << " is registered for " << event->getName() << ".\n";
     }
 
     /**
-     * [FILE HANDLING]
-     * Saves the entire in-memory hash table back to the
-     * sequential file, overwriting it.
+     * [FILE HANDLING + HASHING]
+     * Streams registrations from a CSV file with rows of
+     * eventID,studentID,studentName. Rows are validated, grouped by event
+     * in batches and appended in bulk.
      */
-    void saveEventsToFile() {
-        ofstream outFile(FILENAME);
-        if (!outFile) {
-            cerr << "Error: Could not open " << FILENAME << " for writing." << endl;
+    void bulkImportRegistrations() {
+        string csvFile;
+        finishPendingExport();
+        cout << "\n--- Bulk Import Registrations (CSV) ---\n";
+        cout << "Enter CSV file path: ";
+        getline(cin, csvFile);
+        csvFile = trim(csvFile);
+
+        ifstream inFile(csvFile);
+        if (!inFile) {
+            cout << "Error: Could not open '" << csvFile << "'.\n";
             return;
         }
 
-        for (int i = 0; i < TABLE_SIZE; ++i) {
-            EventNode* event = hashTable[i];
-            while (event != nullptr) {
-                // Save all 5 fields now
-                outFile << event->eventID << "|" << event->eventName << "|"
-                        << event->date << "|" << event->venue << "|" << event->sortableDate << "\n";
-                
-                AttendeeNode* att = event->attendeeHead;
-                while (att != nullptr) {
-                    outFile << att->studentID << "|" << att->studentName << "\n";
-                    att = att->next;
-                }
-                
-                outFile << "END_EVENT\n";
-                event = event->next;
+        const size_t BATCH_SIZE = 50000;
+        auto startTime = chrono::steady_clock::now();
+
+        ImportReport report;
+        unordered_map<string, vector<ImportRow>> batch;
+        size_t rowsInBatch = 0;
+        long long rowsRead = 0;
+        int lineNo = 0;
+        string line;
+
+        while (getline(inFile, line)) {
+            lineNo++;
+            if (trim(line).empty()) continue;
+
+            vector<string> fields = parseCsvLine(line);
+            for (string& field : fields) {
+                field = trim(field);
+            }
+
+            // Skip a header row such as "eventID,studentID,studentName"
+            if (lineNo == 1 && !fields.empty()) {
+                string first = fields[0];
+                transform(first.begin(), first.end(), first.begin(), ::tolower);
+                if (first == "eventid") continue;
+            }
+
+            rowsRead++;
+            if (fields.size() != 3) {
+                recordImportError(report, lineNo, "Expected 3 fields, found " + to_string(fields.size()) + ".");
+                continue;
+            }
+            if (!isValidID(fields[0])) {
+                recordImportError(report, lineNo, "Invalid Event ID '" + fields[0] + "'.");
+                continue;
+            }
+            if (!isValidID(fields[1])) {
+                recordImportError(report, lineNo, "Invalid Student ID '" + fields[1] + "'.");
+                continue;
+            }
+            if (!isValidName(fields[2])) {
+                recordImportError(report, lineNo, "Invalid student name '" + fields[2] + "'.");
+                continue;
+            }
+
+            batch[fields[0]].push_back({lineNo, fields[1], fields[2]});
+            if (++rowsInBatch >= BATCH_SIZE) {
+                applyImportBatch(batch, report);
+                rowsInBatch = 0;
+            }
+        }
+        applyImportBatch(batch, report);
+        inFile.close();
+
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+
+        cout << "\n----------------------------------------\n";
+        cout << "Rows Read:                 " << rowsRead << "\n";
+        cout << "Registrations Imported:    " << report.imported << "\n";
+        cout << "Already Registered:        " << report.duplicates << "\n";
+        cout << "Rows With Errors:          " << report.errors << "\n";
+        cout << "Time Taken:                " << fixed << setprecision(3) << seconds << " s\n";
+        if (seconds > 0) {
+            cout << "Throughput:                " << setprecision(0) << rowsRead / seconds << " rows/s\n";
+        }
+        cout.unsetf(ios::fixed);
+        cout << setprecision(6);
+
+        if (!report.errorMessages.empty()) {
+            vector<string> messages;
+            for (; !report.errorMessages.empty(); report.errorMessages.pop()) {
+                messages.push_back(report.errorMessages.top().second);
+            }
+            cout << "----------------------------------------\n";
+            cout << "Errors:\n";
+            for (auto it = messages.rbegin(); it != messages.rend(); ++it) {
+                cout << "  " << *it << "\n";
+            }
+            if (report.errors > (long long)messages.size()) {
+                cout << "  ... and " << report.errors - messages.size() << " more.\n";
             }
         }
-        outFile.close();
-        cout << "\n[System] All events saved to " << FILENAME << endl;
+        cout << "----------------------------------------\n";
     }
 
-
     /**
-     * [HASHING + LINKED LIST]
-     * Adds a new event to the in-memory hash table..
+     * [FILE HANDLING]
+     * Exports events, attendees and per-event counts as CSV or JSON Lines,
+     * optionally on a background thread.
      */
-    void addEvent() {
-        string id, name, date, venue;
-        cout << "\n--- Add New Event --- \n";
-        cout << "Enter Event ID (e.g., 'TECH01'): ";
-        cin >> id;
+    void exportReports() {
+        cout << "\n--- Export Reports ---\n";
+        cout << "  1. CSV\n";
+        cout << "  2. JSON Lines\n";
+        cout << "  0. Back to Main Menu\n";
+        cout << "Enter choice: ";
+
+        int choice;
+        cin >> choice;
         clearInputBuffer();
 
-        if (!isValidID(id)) {
-            cout << "Invalid ID format. Use only letters and numbers. Aborting.\n";
+        if (choice != 1 && choice != 2) {
+            if (choice != 0) cout << "Invalid choice.\n";
             return;
         }
 
-        if (findEvent(id) != nullptr) {
-            cout << "Error: Event ID '" << id << "' already exists!\n";
-            return;
-        }
+        cout << "Run in background? (y/n): ";
+        char background;
+        cin >> background;
+        clearInputBuffer();
 
-        while(true) {
-            cout << "Enter Event Name (e.g., 'CodeFest'): ";
-            getline(cin, name);
-            if(isValidName(name)) break;
-            cout << "Invalid name. Use only letters and spaces.\n";
-        }
-        
-        while(true) {
-            cout << "Enter Event Date (DD/MM/YYYY): ";
-            cin >> date;
-            clearInputBuffer();
-            if(isValidDate(date)) break;
-            cout << "Invalid date format. Use DD/MM/YYYY.\n";
+        // Wait for an earlier export before touching the table, then load
+        // everything up front so this export never mutates it.
+        finishPendingExport();
+        ensureAllShardsLoaded();
+
+        bool asJson = (choice == 2);
+        if (background == 'y' || background == 'Y') {
+            exportThread = thread([this, asJson] {
+                exportMessage = runExport(asJson);
+                exportFinished = true;
+            });
+            cout << "Export started in the background. Changes will wait for it to finish.\n";
+        } else {
+            cout << "\n" << runExport(asJson) << endl;
         }
+    }
 
-        while(true) {
-            cout << "Enter Event Venue: ";
-            getline(cin, venue);
-            if(isValidVenue(venue)) break;
-            cout << "Invalid venue. Use only letters and spaces.\n";
-        }
+    /**
+     * Prints the summary of a background export once it has finished.
+     * Called from the menu loop, so only the main thread writes to cout.
+     */
+    void reportFinishedExport() {
+        if (exportFinished) finishPendingExport();
+    }
 
-        // Convert date to sortable format
-        string sort_dt = toSortableDate(date);
+    /**
+     * [UNDO/REDO + AUDIT]
+     * Undo/redo recent changes, or inspect the saved history of an event.
+     */
+    void manageHistory() {
+        cout << "\n--- Undo / Redo / History ---\n";
+        size_t redoSteps = count_if(redoStack.begin(), redoStack.end(),
+                                    [](const Operation& op) { return !op.continuesPrevious; });
+        cout << "  1. Undo Last Change (" << undoSteps << " available)\n";
+        cout << "  2. Redo Last Change (" << redoSteps << " available)\n";
+        cout << "  3. View Event History\n";
+        cout << "  4. View Event As Of a Past Time\n";
+        cout << "  0. Back to Main Menu\n";
+        cout << "Enter choice: ";
 
-        EventNode* newNode = new EventNode(id, name, date, venue, sort_dt);
+        int choice;
+        cin >> choice;
+        clearInputBuffer();
 
-        int index = hashFunction(id);
-        
-        newNode->next = hashTable[index];
-        hashTable[index] = newNode;
+        switch (choice) {
+            case 1:
+                finishPendingExport();
+                undoLastChange();
+                break;
+            case 2:
+                finishPendingExport();
+                redoLastChange();
+                break;
+            case 3:
+            case 4: {
+                string eventID;
+                cout << "Enter Event ID: ";
+                cin >> eventID;
+                clearInputBuffer();
 
-        cout << "\nSuccess! Event '" << name << "' added.\n";
+                if (choice == 3) {
+                    showEventHistory(eventID);
+                    break;
+                }
 
+                string when;
+                time_t parsed;
+                while (true) {
+                    cout << "Enter time (DD/MM/YYYY HH:MM): ";
+                    getline(cin, when);
+                    parsed = parseDateTime(when);
+                    if (parsed != -1) break;
+                    cout << "Invalid time format. Use DD/MM/YYYY HH:MM.\n";
+                }
+                showEventAtTime(eventID, parsed);
+                break;
+            }
+            case 0:
+                return;
+            default:
+                cout << "Invalid choice.\n";
+                break;
+        }
     }
 
     /**
-     * [LINKED LIST]
-     * Registers a student for an event.
+     * [VENUE INDEX]
+     * Per-venue queries answered from the venue index and the per-event
+     * attendee counts, without walking any attendee list.
      */
-    void registerForEvent() {
-        string eventID;
-        cout << "\n--- Register for Event ---\n";
-        cout << "Enter Event ID to register for: ";
-        cin >> eventID;
+    void venueReports() {
+        cout << "\n--- Venue Reports ---\n";
+        cout << "  1. List Events at a Venue\n";
+        cout << "  2. Event and Registration Totals per Venue\n";
+        cout << "  3. Busiest Dates at a Venue\n";
+        cout << "  0. Back to Main Menu\n";
+        cout << "Enter choice: ";
+
+        int choice;
+        cin >> choice;
         clearInputBuffer();
 
-        EventNode* event = findEvent(eventID);
+        if (choice < 1 || choice > 3) {
+            if (choice != 0) cout << "Invalid choice.\n";
+            return;
+        }
+        ensureAllShardsLoaded();
+
+        if (choice == 2) {
+            // An optional month narrows each venue's date range
+            string month;
+            string fromKey = "", toKey = "\x7f";
+            while (true) {
+                cout << "Enter month (MM/YYYY), or leave blank for all time: ";
+                getline(cin, month);
+                if (month.empty()) break;
+                if (isValidDate("01/" + month)) {
+                    fromKey = month.substr(3, 4) + month.substr(0, 2);
+                    toKey = fromKey + "\x7f";
+                    break;
+                }
+                cout << "Invalid month. Use MM/YYYY.\n";
+            }
 
-        if (event == nullptr) {
-            cout << "Error: Event '" << eventID << "' not found.\n";
+            cout << "\n------------------------------------------------------------------\n";
+            cout << left << setw(30) << "Venue" << setw(10) << "Events" << setw(15) << "Registrations" << "\n";
+            cout << "------------------------------------------------------------------\n";
+            bool any = false;
+            for (size_t v = 0; v < venues.size(); ++v) {
+                const OrderedIndex& atVenue = eventsByVenue[v];
+                auto first = atVenue.lower_bound({fromKey, ""});
+                auto last = atVenue.lower_bound({toKey, ""});
+
+                int events = 0;
+                long long registrations = 0;
+                for (auto it = first; it != last; ++it) {
+                    events++;
+                    registrations += it->second->attendeeCount;
+                }
+                if (events == 0) continue;
+                cout << left << setw(30) << venues.get(v) << setw(10) << events << setw(15) << registrations << "\n";
+                any = true;
+            }
+            if (!any) cout << "No events found.\n";
+            cout << "------------------------------------------------------------------\n";
             return;
         }
 
-        string studentID, studentName;
-        cout << "Found Event: " << event->eventName << "\n";
-        
-        while(true) {
-            cout << "Enter your Student ID: ";
-            cin >> studentID;
-            clearInputBuffer();
-            if(isValidID(studentID)) break;
-            cout << "Invalid ID. Use only letters and numbers.\n";
+        string venue;
+        cout << "Enter Venue: ";
+        getline(cin, venue);
+        int v = findVenue(venue);
+        if (v == -1 || eventsByVenue[v].empty()) {
+            cout << "No events found at '" << venue << "'.\n";
+            return;
         }
 
-        while(true) {
-            cout << "Enter your Full Name: ";
-            getline(cin, studentName);
-            if(isValidName(studentName)) break;
-            cout << "Invalid name. Use only letters and spaces.\n";
+        if (choice == 1) {
+            ostringstream header;
+            header << left << setw(15) << "Date"
+                   << setw(30) << "Name"
+                   << setw(10) << "EventID"
+                   << setw(15) << "Attendees" << "\n";
+
+            cout << "\nEvents at " << venue << ":\n";
+            browseIndex(eventsByVenue[v], header.str(),
+                [](EventNode*) { return true; },
+                [](ostringstream& out, EventNode* event) {
+                    out << left << setw(15) << event->getDate()
+                        << setw(30) << event->getName()
+                        << setw(10) << event->eventID
+                        << setw(15) << event->attendeeCount << "\n";
+                });
+            return;
         }
 
-        AttendeeNode* newAttendee = new AttendeeNode(studentID, studentName);
+        // Events are already grouped by date inside the venue's set
+        vector<pair<long long, string>> byDate; // (registrations, date)
+        for (const auto& entry : eventsByVenue[v]) {
+            EventNode* event = entry.second;
+            if (byDate.empty() || byDate.back().second != event->getDate()) {
+                byDate.push_back({0, event->getDate()});
+            }
+            byDate.back().first += event->attendeeCount;
+        }
 
-        
-        newAttendee->next = event->attendeeHead;
-        event->attendeeHead = newAttendee;
+        const size_t TOP_DATES = 5;
+        size_t k = min(TOP_DATES, byDate.size());
+        partial_sort(byDate.begin(), byDate.begin() + k, byDate.end(),
+                     [](const pair<long long, string>& a, const pair<long long, string>& b) {
+                         return a.first > b.first;
+                     });
 
-        cout << "\nSuccess! " << studentName << " is registered for " << event->eventName << ".\n";
+        cout << "\nBusiest Dates at " << venue << ":\n";
+        cout << "----------------------------------------\n";
+        cout << left << setw(15) << "Date" << setw(15) << "Registrations" << "\n";
+        cout << "----------------------------------------\n";
+        for (size_t i = 0; i < k; ++i) {
+            cout << left << setw(15) << byDate[i].second << setw(15) << byDate[i].first << "\n";
+        }
+        cout << "----------------------------------------\n";
     }
 
     // manageEvent` now includes Update and Remove ---
     void manageEvent() {
         string eventID;
+        finishPendingExport();
         cout << "\n--- Manage/Remove Event ---\n";
         cout << "Enter Event ID to manage: ";
         cin >> eventID;
         clearInputBuffer();
 
-        int index = hashFunction(eventID);
-        EventNode* event = hashTable[index];
-        EventNode* prev = nullptr;
-
-        // Traverse the linked list (chain) to find the event
-        while (event != nullptr && event->eventID != eventID) {
-            prev = event;
-            event = event->next;
-        }
+        EventNode* event = findEvent(eventID);
 
         // Case 1: Event not found
         if (event == nullptr) {
@@ -565,7 +3372,7 @@ public:
         }
 
         // Case 2: Event is found
-        cout << "\nFound Event: " << event->eventName;
+        cout << "\nFound Event: " << event->getName();
         cout << "\nWhat do you want to do?\n";
         cout << "  1. Update Event Name\n";
         cout << "  2. Update Event Date\n";
@@ -587,7 +3394,11 @@ public:
                     if(isValidName(newName)) break;
                     cout << "Invalid name. Use only letters and spaces.\n";
                 }
-                event->eventName = newName;
+                Operation op(Operation::UPDATE_NAME, eventID);
+                op.before = event->getName();
+                op.after = newName;
+                setEventField(event, op.kind, newName);
+                recordOperation(move(op), event);
                 cout << "Success! Event Name updated.\n";
                 break;
             }
@@ -600,8 +3411,11 @@ public:
                     if(isValidDate(newDate)) break;
                     cout << "Invalid date format. Use DD/MM/YYYY.\n";
                 }
-                event->date = newDate;
-                event->sortableDate = toSortableDate(newDate); // Don't forget to update this!
+                Operation op(Operation::UPDATE_DATE, eventID);
+                op.before = event->getDate();
+                op.after = newDate;
+                setEventField(event, op.kind, newDate); // Also updates sortableDate
+                recordOperation(move(op), event);
                 cout << "Success! Event Date updated.\n";
                 break;
             }
@@ -613,13 +3427,17 @@ public:
                     if(isValidVenue(newVenue)) break;
                     cout << "Invalid venue. Use only letters and spaces.\n";
                 }
-                event->venue = newVenue;
+                Operation op(Operation::UPDATE_VENUE, eventID);
+                op.before = event->getVenue();
+                op.after = newVenue;
+                setEventField(event, op.kind, newVenue);
+                recordOperation(move(op), event);
                 cout << "Success! Event Venue updated.\n";
                 break;
             }
             case 4: {
                 // --- This is the logic from your old `removeEvent` function ---
-                cout << "Are you sure you want to delete '" << event->eventName << "'? (y/n): ";
+                cout << "Are you sure you want to delete '" << event->getName() << "'? (y/n): ";
                 char confirm;
                 cin >> confirm;
                 if (confirm != 'y' && confirm != 'Y') {
@@ -627,26 +3445,12 @@ public:
                     break;
                 }
 
-                // Unlink it from the list.
-                if (prev == nullptr) {
-                    hashTable[index] = event->next;
-                } else {
-                    prev->next = event->next;
-                }
-                
-                // 1. Delete its attendee list
-                AttendeeNode* attCurrent = event->attendeeHead;
-                while (attCurrent != nullptr) {
-                    AttendeeNode* attToDelete = attCurrent;
-                    attCurrent = attCurrent->next;
-                    delete attToDelete;
-                }
-                string removedEventName = event->eventName;
-                
-                // 2. Delete the event node itself
-                delete event;
+                // Unlink it, but keep the node (and its attendees) in the
+                // undo history instead of freeing it right away.
+                string removedEventName = event->getName();
+                removeEvent(eventID);
 
-                cout << "\nSuccess! Event '" << removedEventName << "' has been removed.\n";
+                cout << "\nSuccess! Event '" << removedEventName << "' has been removed. (Use Undo to restore it.)\n";
                 break;
             }
             case 0:
@@ -664,6 +3468,7 @@ public:
         cout << "\n--- Search for Event ---\n";
         cout << "  1. Search by Event ID (View details)\n";
         cout << "  2. Search by Event Name (Find event)\n";
+        cout << "  3. Fuzzy Search by Event Name (Typo-tolerant)\n";
         cout << "  0. Back to Main Menu\n";
         cout << "Enter choice: ";
 
@@ -688,28 +3493,20 @@ public:
 
                 cout << "\n----------------------------------------\n";
                 cout << "Event ID:    " << event->eventID << "\n";
-                cout << "Name:        " << event->eventName << "\n";
-                cout << "Date:        " << event->date << "\n";
-                cout << "Venue:       " << event->venue << "\n";
+                cout << "Name:        " << event->getName() << "\n";
+                cout << "Date:        " << event->getDate() << "\n";
+                cout << "Venue:       " << event->getVenue() << "\n";
                 cout << "----------------------------------------\n";
                 cout << "Registered Attendees:\n";
-                AttendeeNode* attCurrent = event->attendeeHead;
-                if (attCurrent == nullptr) {
-                    cout << "  (No attendees registered yet)\n";
-                } else {
-                    int count = 1;
-                    while (attCurrent != nullptr) {
-                        cout << "  " << count << ". " << attCurrent->studentName << " (ID: " << attCurrent->studentID << ")\n";
-                        attCurrent = attCurrent->next;
-                        count++;
-                    }
-                }
-                cout << "----------------------------------------\n";
+                browseAttendees(event);
                 break;
             }
             case 2:
                 searchEventByName();
                 break;
+            case 3:
+                fuzzySearchEventByName();
+                break;
             case 0:
                 return;
             default:
@@ -749,46 +3546,411 @@ public:
 
     void showStatistics() {
         cout << "\n--- System Statistics ---\n";
+        ensureAllShardsLoaded();
 
         int totalEvents = 0;
         int totalReg = 0;
         EventNode* popularEvent = nullptr;
         int maxAttendees = -1;
-
-        for (int i = 0; i < TABLE_SIZE; ++i) {
-            EventNode* current = hashTable[i];
-            while (current != nullptr) {
-                totalEvents++;
-                
-                int currentAttendees = 0;
-                AttendeeNode* attCurrent = current->attendeeHead;
-                while (attCurrent != nullptr) {
-                    totalReg++;
-                    currentAttendees++;
-                    attCurrent = attCurrent->next;
-                }
-
-                if (currentAttendees > maxAttendees) {
-                    maxAttendees = currentAttendees;
-                    popularEvent = current;
-                }
-                current = current->next;
+        size_t perRegistrationStringBytes = 0;
+
+        hashTable.forEach([&](EventNode* current) {
+            totalEvents++;
+
+            int currentAttendees = 0;
+            forEachAttendee(current, [&](int handle) {
+                totalReg++;
+                currentAttendees++;
+                const StudentRecord& student = students.get(handle);
+                perRegistrationStringBytes += StringInterner::stringHeapBytes(student.studentID)
+                                            + StringInterner::stringHeapBytes(student.studentName);
+            });
+
+            if (currentAttendees > maxAttendees) {
+                maxAttendees = currentAttendees;
+                popularEvent = current;
             }
-        }
+        });
 
         cout << "Total Events in System:    " << totalEvents << "\n";
         cout << "Total Registrations:       " << totalReg << "\n";
         
         if (popularEvent != nullptr) {
-            cout << "Most Popular Event:        " << popularEvent->eventName 
+            cout << "Most Popular Event:        " << popularEvent->getName() 
                  << " (" << maxAttendees << " attendees)\n";
         } else {
             cout << "Most Popular Event:        N/A (No events)\n";
         }
+
+        // Compare against storing an ID/name string pair in every node
+        size_t internedBytes = totalReg * AttendeePolicy::BYTES_PER_ATTENDEE + students.memoryUsage();
+        size_t copiedBytes = totalReg * (2 * sizeof(string) + sizeof(AttendeeNode*)) + perRegistrationStringBytes;
+        cout << "Unique Students:           " << students.size() << "\n";
+        if (students.size() > 0) {
+            cout << "Events per Student:        " << fixed << setprecision(2)
+                 << (double)totalReg / students.size() << "\n";
+            cout.unsetf(ios::fixed);
+            cout << setprecision(6);
+        }
+        cout << "Attendee Memory:           " << internedBytes / 1024 << " KB (vs. "
+             << copiedBytes / 1024 << " KB with per-registration copies)\n";
         cout << "----------------------------------------\n";
     }
 };
 
+// --- TRACKER CONFIGURATIONS ---
+
+// The original layout: chained hash table, linked attendee lists, own strings.
+typedef EventTracker<ChainedIndex, LinkedAttendees, PlainStrings> ClassicTracker;
+
+// Open addressing, contiguous attendee handles and interned strings.
+typedef EventTracker<OpenAddressingIndex, ContiguousAttendees, InternedStrings> FastTracker;
+
+// Compile with -DFAST_TRACKER to run the menu on the high-performance layout.
+#ifdef FAST_TRACKER
+typedef FastTracker ActiveTracker;
+#else
+typedef ClassicTracker ActiveTracker;
+#endif
+
+// --- BENCHMARK HARNESS ---
+
+struct BenchmarkEvent {
+    string id, name, date, venue;
+};
+
+struct BenchmarkData {
+    vector<BenchmarkEvent> events;
+    vector<pair<int, int>> registrations; // (event index, student number)
+    vector<string> lookups;               // Half hits, half misses
+    vector<string> venues;
+};
+
+/**
+ * Builds the same synthetic workload for every configuration.
+ * A fixed seed keeps runs comparable.
+ */
+BenchmarkData makeBenchmarkData(int eventCount, int registrationCount) {
+    static const char* words[] = {
+        "Code", "Fest", "Hack", "Robo", "Quiz", "Data", "Cloud", "Cyber",
+        "Design", "Music", "Drama", "Tech", "Talk", "Sprint", "League", "Expo"
+    };
+    const int wordCount = sizeof(words) / sizeof(words[0]);
+
+    BenchmarkData data;
+    mt19937 rng(2024);
+
+    for (int v = 0; v < 20; ++v) {
+        data.venues.push_back("Hall " + to_string(v + 1));
+    }
+
+    for (int i = 0; i < eventCount; ++i) {
+        BenchmarkEvent e;
+        e.id = "EV" + to_string(100000 + i);
+        e.name = string(words[rng() % wordCount]) + words[rng() % wordCount] + " " + words[rng() % wordCount];
+        char date[11];
+        snprintf(date, sizeof(date), "%02d/%02d/%04d", 1 + (int)(rng() % 28), 1 + (int)(rng() % 12), 2024 + (int)(rng() % 3));
+        e.date = date;
+        e.venue = data.venues[rng() % data.venues.size()];
+        data.events.push_back(e);
+    }
+
+    // About six events per student
+    int studentCount = max(1, registrationCount / 6);
+    for (int r = 0; r < registrationCount; ++r) {
+        data.registrations.push_back({(int)(rng() % eventCount), (int)(rng() % studentCount)});
+    }
+
+    for (int i = 0; i < eventCount; ++i) {
+        data.lookups.push_back(i % 2 == 0 ? data.events[rng() % eventCount].id : "XX" + to_string(i));
+    }
+    return data;
+}
+
+/**
+ * Runs one configuration over the shared workload and prints phase timings.
+ * Uses its own storage name and never saves, so no data files are touched.
+ */
+template <class Tracker>
+void runBenchmark(const string& label, const BenchmarkData& data) {
+    typedef chrono::steady_clock Clock;
+    auto millis = [](Clock::time_point from) {
+        return chrono::duration<double, milli>(Clock::now() - from).count();
+    };
+
+    cout << "\n" << label << "\n";
+    Clock::time_point total = Clock::now();
+    Tracker tracker(10007, "bench_tmp_" + label);
+
+    Clock::time_point start = Clock::now();
+    for (const BenchmarkEvent& e : data.events) {
+        tracker.createEvent(e.id, e.name, e.date, e.venue);
+    }
+    cout << "  Add events:        " << fixed << setprecision(1) << millis(start) << " ms\n";
+
+    start = Clock::now();
+    long long accepted = 0;
+    for (const pair<int, int>& r : data.registrations) {
+        string studentID = "S" + to_string(r.second);
+        if (tracker.registerStudent(data.events[r.first].id, studentID, "Student " + studentID)) accepted++;
+    }
+    cout << "  Registrations:     " << millis(start) << " ms (" << accepted << " accepted)\n";
+
+    start = Clock::now();
+    int hits = 0;
+    for (int round = 0; round < 10; ++round) {
+        for (const string& id : data.lookups) {
+            if (tracker.hasEvent(id)) hits++;
+        }
+    }
+    cout << "  Lookups (x10):     " << millis(start) << " ms (" << hits << " hits)\n";
+
+    start = Clock::now();
+    long long scanned = tracker.countRegistrations();
+    cout << "  Attendee scan:     " << millis(start) << " ms (" << scanned << " attendees)\n";
+
+    start = Clock::now();
+    long long atVenues = 0;
+    for (const string& venue : data.venues) {
+        atVenues += tracker.venueRegistrations(venue);
+    }
+    cout << "  Venue totals:      " << millis(start) << " ms (" << atVenues << " attendees)\n";
+
+    start = Clock::now();
+    for (size_t i = 0; i < data.events.size(); i += 2) {
+        tracker.removeEvent(data.events[i].id);
+    }
+    cout << "  Remove half:       " << millis(start) << " ms\n";
+
+    cout << "  Total:             " << millis(total) << " ms\n";
+    cout.unsetf(ios::fixed);
+    cout << setprecision(6);
+}
+
+void runBenchmarks(int eventCount, int registrationCount) {
+    cout << "Benchmark: " << eventCount << " events, " << registrationCount << " registrations\n";
+    BenchmarkData data = makeBenchmarkData(eventCount, registrationCount);
+    runBenchmark<ClassicTracker>("classic", data);
+    runBenchmark<FastTracker>("fast", data);
+}
+
+// --- LOADER STRESS TEST ---
+
+string readWholeFile(const string& path) {
+    ifstream in(path, ios::binary);
+    return string(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+}
+
+void writeWholeFile(const string& path, const string& contents) {
+    ofstream out(path, ios::binary | ios::trunc);
+    out << contents;
+}
+
+/**
+ * Byte range [begin, end) of one saved event block.
+ */
+struct SavedBlock {
+    string eventID;
+    size_t begin, end;
+};
+
+vector<SavedBlock> splitSavedBlocks(const string& contents) {
+    vector<SavedBlock> blocks;
+    size_t begin = 0;
+    for (size_t pos = 0; pos < contents.size();) {
+        size_t eol = contents.find('\n', pos);
+        if (eol == string::npos) eol = contents.size() - 1;
+        if (contents.compare(pos, 9, "END_EVENT") == 0) {
+            blocks.push_back({contents.substr(begin, contents.find('|', begin) - begin), begin, eol + 1});
+            begin = eol + 1;
+        }
+        pos = eol + 1;
+    }
+    return blocks;
+}
+
+/**
+ * Reloads the damaged files with one configuration. Every event that
+ * loads must match its original block exactly, and every block that is
+ * not next to the damage must load.
+ */
+template <class Tracker>
+bool checkReload(const string& storageName, const map<string, string>& originals,
+                 const set<string>& required, int& skipped) {
+    streambuf* console = cout.rdbuf(nullptr); // Silence the loader's reports
+    Tracker tracker(101, storageName);
+    vector<string> loaded = tracker.listEventIDs();
+    bool ok = true;
+    string failure;
+    for (const string& id : loaded) {
+        auto original = originals.find(id);
+        if (original == originals.end() || tracker.eventRecord(id) != original->second) {
+            failure = "damaged event '" + id + "' was accepted";
+            ok = false;
+        }
+    }
+    set<string> present(loaded.begin(), loaded.end());
+    for (const string& id : required) {
+        if (!present.count(id)) {
+            failure = "intact event '" + id + "' was lost";
+            ok = false;
+        }
+    }
+    cout.rdbuf(console);
+    if (!ok) cout << "  FAIL: " << failure << "\n";
+    skipped += originals.size() - loaded.size();
+    return ok;
+}
+
+/**
+ * Times a full load of a large saved data set with one configuration,
+ * using the same table size as the menu program.
+ */
+template <class Tracker>
+void timeLargeLoad(const string& label, const string& storageName, size_t expected) {
+    typedef chrono::steady_clock Clock;
+    Clock::time_point start = Clock::now();
+    streambuf* console = cout.rdbuf(nullptr);
+    Tracker tracker(10, storageName);
+    size_t loaded = tracker.listEventIDs().size();
+    cout.rdbuf(console);
+    cout << "  " << left << setw(9) << label << fixed << setprecision(1)
+         << chrono::duration<double, milli>(Clock::now() - start).count() << " ms ("
+         << loaded << " of " << expected << " events)\n";
+    cout << right;
+    cout.unsetf(ios::fixed);
+    cout << setprecision(6);
+}
+
+/**
+ * Saves a generated data set, then repeatedly truncates, bit-flips or
+ * drops a stray '|' into one shard and reloads it with both
+ * configurations. Returns false if any reload accepted damaged data or
+ * lost an undamaged block.
+ */
+bool fuzzLoader(int iterations) {
+    const string storageName = "fuzz_tmp";
+    BenchmarkData data = makeBenchmarkData(400, 3000);
+    mt19937 rng(7);
+
+    map<string, string> originals;
+    vector<string> shardFiles, storageFiles;
+    {
+        streambuf* console = cout.rdbuf(nullptr);
+        ClassicTracker writer(101, storageName);
+        for (const BenchmarkEvent& e : data.events) {
+            writer.createEvent(e.id, e.name, e.date, e.venue);
+        }
+        for (const pair<int, int>& r : data.registrations) {
+            string studentID = "S" + to_string(r.second);
+            writer.registerStudent(data.events[r.first].id, studentID, "Student " + studentID);
+        }
+        writer.saveEventsToFile();
+        cout.rdbuf(console);
+
+        for (const BenchmarkEvent& e : data.events) {
+            originals[e.id] = writer.eventRecord(e.id);
+        }
+        shardFiles = writer.shardFiles();
+        storageFiles = writer.storageFiles();
+    }
+
+    vector<string> contents;
+    for (const string& file : shardFiles) {
+        contents.push_back(readWholeFile(file));
+    }
+
+    cout << "Loader stress test: " << iterations << " damaged reloads of " << originals.size()
+         << " events (CRC32C " << (CRC32C::hasHardwareSupport() ? "SSE4.2" : "table") << ")\n";
+
+    int failures = 0, skipped = 0;
+    const char* modes[] = {"truncate", "bit flip", "stray '|'"};
+    for (int i = 0; i < iterations; ++i) {
+        int shard = rng() % shardFiles.size();
+        const string& original = contents[shard];
+        if (original.empty()) continue;
+
+        // Apply one kind of damage, remembering where it landed
+        string damaged = original;
+        vector<size_t> hits;
+        size_t cut = string::npos;
+        int mode = i % 3;
+        if (mode == 0) {
+            cut = rng() % original.size();
+            damaged.resize(cut);
+        } else if (mode == 1) {
+            for (int flips = 1 + rng() % 3; flips > 0; --flips) {
+                size_t pos = rng() % original.size();
+                damaged[pos] ^= (char)(1 << (rng() % 8));
+                hits.push_back(pos);
+            }
+        } else {
+            size_t pos = rng() % original.size();
+            damaged.insert(pos, 1, '|');
+            hits.push_back(pos);
+        }
+        writeWholeFile(shardFiles[shard], damaged);
+
+        // A hit can take out its own block and the one after it
+        set<string> required;
+        for (const pair<const string, string>& event : originals) {
+            required.insert(event.first);
+        }
+        vector<SavedBlock> blocks = splitSavedBlocks(original);
+        for (size_t b = 0; b < blocks.size(); ++b) {
+            bool lost = cut != string::npos && blocks[b].end > cut;
+            for (size_t pos : hits) {
+                if (pos >= blocks[b].begin && pos < blocks[b].end) lost = true;
+                if (b > 0 && pos >= blocks[b - 1].begin && pos < blocks[b - 1].end) lost = true;
+            }
+            if (lost) required.erase(blocks[b].eventID);
+        }
+
+        bool ok = i % 2 == 0 ? checkReload<ClassicTracker>(storageName, originals, required, skipped)
+                             : checkReload<FastTracker>(storageName, originals, required, skipped);
+        if (!ok) {
+            failures++;
+            cout << "  (iteration " << i << ", " << modes[mode] << " in " << shardFiles[shard] << ")\n";
+        }
+
+        writeWholeFile(shardFiles[shard], original);
+        remove((shardFiles[shard] + ".rejected").c_str());
+    }
+
+    for (const string& file : storageFiles) {
+        remove(file.c_str());
+    }
+
+    cout << "Skipped " << skipped << " damaged block(s) in total; " << failures << " failing reload(s).\n";
+
+    // A large intact file must load in roughly linear time
+    const int largeEvents = 50000;
+    BenchmarkData large = makeBenchmarkData(largeEvents, 6 * largeEvents);
+    {
+        streambuf* console = cout.rdbuf(nullptr);
+        ClassicTracker writer(10007, storageName);
+        for (const BenchmarkEvent& e : large.events) {
+            writer.createEvent(e.id, e.name, e.date, e.venue);
+        }
+        for (const pair<int, int>& r : large.registrations) {
+            string studentID = "S" + to_string(r.second);
+            writer.registerStudent(large.events[r.first].id, studentID, "Student " + studentID);
+        }
+        writer.saveEventsToFile();
+        cout.rdbuf(console);
+    }
+    cout << "Large load: " << largeEvents << " events, " << large.registrations.size() << " registrations\n";
+    timeLargeLoad<ClassicTracker>("classic", storageName, largeEvents);
+    timeLargeLoad<FastTracker>("fast", storageName, largeEvents);
+
+    for (const string& file : storageFiles) {
+        remove(file.c_str());
+    }
+
+    cout << (failures == 0 ? "PASS" : "FAIL") << "\n";
+    return failures == 0;
+}
+
 // --- UTILITY AND MAIN FUNCTIONS ---
 
 void printHeader() {
@@ -809,6 +3971,10 @@ void printMenu() {
     cout << "  4. View All Events\n"; 
     cout << "  5. Manage/Remove Event\n";
     cout << "  6. Show System Statistics\n";
+    cout << "  7. Bulk Import Registrations (CSV)\n";
+    cout << "  8. Export Reports (CSV / JSON Lines)\n";
+    cout << "  9. Undo / Redo / History\n";
+    cout << " 10. Venue Reports\n";
     cout << "  0. Save and Exit\n";
     cout << "Enter your choice: ";
 }
@@ -827,13 +3993,28 @@ void clearScreen() {
 /**
  * Main function to run the program
  */
-int main() {
-    EventTracker tracker(10);
+int main(int argc, char* argv[]) {
+    // dsaMiniproz --benchmark [events] [registrations]
+    if (argc > 1 && string(argv[1]) == "--benchmark") {
+        int eventCount = argc > 2 ? max(1, atoi(argv[2])) : 20000;
+        int registrationCount = argc > 3 ? max(0, atoi(argv[3])) : 200000;
+        runBenchmarks(eventCount, registrationCount);
+        return 0;
+    }
+
+    // dsaMiniproz --fuzz-loader [iterations]
+    if (argc > 1 && string(argv[1]) == "--fuzz-loader") {
+        int iterations = argc > 2 ? max(1, atoi(argv[2])) : 300;
+        return fuzzLoader(iterations) ? 0 : 1;
+    }
+
+    ActiveTracker tracker(10);
     int choice;
 
     while (true) {
         clearScreen();
         printHeader();
+        tracker.reportFinishedExport();
         printMenu();
         
         while (!(cin >> choice)) {
@@ -862,6 +4043,18 @@ int main() {
             case 6:
                 tracker.showStatistics();
                 break;
+            case 7:
+                tracker.bulkImportRegistrations();
+                break;
+            case 8:
+                tracker.exportReports();
+                break;
+            case 9:
+                tracker.manageHistory();
+                break;
+            case 10:
+                tracker.venueReports();
+                break;
             case 0:
                 cout << "Saving events to file...\n";
                 tracker.saveEventsToFile();